@@ -1,5 +1,35 @@
 // ============ GENALG-static inline.C ================
 
+// ------------- GARng
+
+// ================ Functions implementation ====================
+
+// Return a random value in [0.0, 1.0[ from the GARng 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+float GARngUnif(GARng* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // Get the result from the current state
+  uint32_t res = that->_s[0] + that->_s[3];
+  // Step the state
+  uint32_t t = that->_s[1] << 9;
+  that->_s[2] ^= that->_s[0];
+  that->_s[3] ^= that->_s[1];
+  that->_s[1] ^= that->_s[2];
+  that->_s[0] ^= that->_s[3];
+  that->_s[2] ^= t;
+  that->_s[3] = (that->_s[3] << 11) | (that->_s[3] >> 21);
+  // Convert the 24 upper bits of the result into a float
+  return (float)(res >> 8) * 0x1.0p-24f;
+}
+
 // ------------- GenAlgAdn
 
 // ================ Functions implementation ====================
@@ -195,6 +225,8 @@ float GAAdnGetVal(const GenAlgAdn* const that) {
 }
 
 // Return true if the GenAlgAdn 'that' is new, i.e. is age equals 1
+// and its value has not been found in the fitness cache of its 
+// GenAlg
 // Return false
 #if BUILDMODE != 0
 static inline
@@ -207,7 +239,27 @@ bool GAAdnIsNew(const GenAlgAdn* const that) {
     PBErrCatch(GenAlgErr);
   }
 #endif
-  return (that->_age == 1);
+  return (that->_age == 1 && that->_flagCachedVal == false);
+}
+
+// Return true if the evaluation of the GenAlgAdn 'that' has been 
+// aborted by GAEvaluateRace, its value is then only an upper bound of
+// its actual value
+// The flag is not saved: GASave, GASaveBinary and the checkpoints 
+// save the upper bound as the value of the adn. The aborted adns are 
+// not recorded in the fitness cache
+#if BUILDMODE != 0
+static inline
+#endif
+bool GAAdnIsPartial(const GenAlgAdn* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_flagPartialVal;
 }
 
 // Copy the GenAlgAdn 'tho' into the GenAlgAdn 'that'
@@ -230,6 +282,8 @@ void GAAdnCopy(GenAlgAdn* const that, const GenAlgAdn* const tho) {
   that->_id = tho->_id;
   that->_age = tho->_age;
   that->_val = tho->_val;
+  that->_flagCachedVal = tho->_flagCachedVal;
+  that->_flagPartialVal = tho->_flagPartialVal;
   if (tho->_adnF != NULL)
     VecCopy(that->_adnF, tho->_adnF);
   else
@@ -463,6 +517,21 @@ unsigned long int GAGetCurEpoch(const GenAlg* const that) {
   return that->_curEpoch;
 }
 
+// Return the seed of the random generators of the GenAlg 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+unsigned long GAGetSeed(const GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_seed;
+}
+
 // Return the number of KTEvent of the GenAlg 'that'
 #if BUILDMODE != 0
 static inline
@@ -604,6 +673,8 @@ void GASetBoundsAdnFloat(GenAlg* const that, const long iGene,
   }
 #endif
   VecCopy(that->_boundsF + iGene, bounds);
+  that->_boundsMinF[iGene] = VecGet(bounds, 0);
+  that->_boundsMaxF[iGene] = VecGet(bounds, 1);
   GAUpdateNormRange(that);
 }
 
@@ -709,8 +780,7 @@ GenAlgAdn* GAAdn(const GenAlg* const that, const int iRank) {
   if (iRank == -1)
     return (GenAlgAdn*)GABestAdn(that);
   else
-    return (GenAlgAdn*)GSetGet(that->_adns,
-      GSetNbElem(that->_adns) - iRank - 1);
+    return (GenAlgAdn*)GSetElemData(that->_ranks[iRank]);
 }
 
 // Set the value of the GenAlgAdn 'adn' of the GenAlg 'that' to 'val'
@@ -733,7 +803,16 @@ void GASetAdnValue(GenAlg* const that, GenAlgAdn* const adn,
 #endif
   // Set the value
   adn->_val = val;
-  GSetElemSetSortVal((GSetElem*)GSetFirstElem(GAAdns(that), adn), val);
+  adn->_flagPartialVal = false;
+  // Get the element of the adn from the rank index, or search it in
+  // the set if the index is not coherent
+  GSetElem* elem = NULL;
+  if (adn->_rank >= 0 && adn->_rank < GAGetNbAdns(that) &&
+    GSetElemData(that->_ranks[adn->_rank]) == adn)
+    elem = that->_ranks[adn->_rank];
+  else
+    elem = (GSetElem*)GSetFirstElem(GAAdns(that), adn);
+  GSetElemSetSortVal(elem, val);
 }
 
 // Get the diversity of the GenAlg 'that'
@@ -754,6 +833,122 @@ float GAGetDiversity(const GenAlg* const that) {
   return diversity;
 }
 
+// Get the average diversity between the pairs of elites of the 
+// GenAlg 'that' at the last call of GAUpdateEliteDiversity
+#if BUILDMODE != 0
+static inline
+#endif
+float GAGetEliteDiversityAvg(const GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif 
+  return that->_eliteDiversity._avg;
+}
+
+// Get the minimum diversity between the pairs of elites of the 
+// GenAlg 'that' at the last call of GAUpdateEliteDiversity
+#if BUILDMODE != 0
+static inline
+#endif
+float GAGetEliteDiversityMin(const GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif 
+  return that->_eliteDiversity._min;
+}
+
+// Get the maximum number of entries in the fitness cache of the 
+// GenAlg 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+int GAGetFitnessCacheSize(const GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif 
+  return that->_fitnessCache._nbMax;
+}
+
+// Get the number of children of the GenAlg 'that' whose value has 
+// been found in the fitness cache
+#if BUILDMODE != 0
+static inline
+#endif
+unsigned long GAGetNbFitnessCacheHit(const GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif 
+  return that->_fitnessCache._nbHit;
+}
+
+// Get the number of children of the GenAlg 'that' whose value has 
+// not been found in the fitness cache
+#if BUILDMODE != 0
+static inline
+#endif
+unsigned long GAGetNbFitnessCacheMiss(const GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif 
+  return that->_fitnessCache._nbMiss;
+}
+
+// Set the flag memorizing if the KT event of the GenAlg 'that' is 
+// triggered by the average diversity between the elites' genes 
+// (true) or by the difference of value between the last two elites 
+// (false, default) to 'flag'
+#if BUILDMODE != 0
+static inline
+#endif
+void GASetFlagEliteDiversity(GenAlg* const that, const bool flag) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // Set the flag
+  that->_flagEliteDiversity = flag;
+}
+
+// Get the flag memorizing if the KT event of the GenAlg 'that' is 
+// triggered by the average diversity between the elites' genes
+#if BUILDMODE != 0
+static inline
+#endif
+bool GAGetFlagEliteDiversity(const GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // Return the flag
+  return that->_flagEliteDiversity;
+}
+
 // Get the diversity threshold of the GenAlg 'that'
 #if BUILDMODE != 0
 static inline
@@ -881,14 +1076,110 @@ void GAHistoryRecordBirth(GAHistory* const that, const GenAlgAdn* child,
     PBErrCatch(GenAlgErr);
   }
 #endif
-  // Create the GAHistoryBirth
-  GAHistoryBirth* birth = PBErrMalloc(GenAlgErr, sizeof(GAHistory));
+  // If the buffer is full, append its content to the log. If the log
+  // can't be written, keep the births and latch the error, it's 
+  // reported by GASaveHistory or GAWaitIO
+  if (that->_births != NULL && that->_nbPending == that->_nbMaxPending) {
+    if (GAHistoryWrite(that) == false)
+      that->_flagError = true;
+    if (that->_nbPending == that->_nbMaxPending)
+      GAHistoryGrow(that);
+  }
+  // Allocate the buffer at the first birth
+  if (that->_births == NULL) {
+    that->_births = PBErrMalloc(GenAlgErr, 
+      sizeof(GAHistoryBirth) * GENALG_HISTORY_BUFFER);
+    that->_nbMaxPending = GENALG_HISTORY_BUFFER;
+  }
+  // Add the birth at the end of the pending ones
+  GAHistoryBirth* birth = that->_births + 
+    (that->_iFirst + that->_nbPending) % that->_nbMaxPending;
   birth->_epoch = epoch;
   birth->_idParents[0] = child->_idParents[0];
   birth->_idParents[1] = child->_idParents[1];
   birth->_idChild = GAAdnGetId(child);
-  // Add the birth to the genealogy of 'that'
-  GSetAppend(&(that->_genealogy), birth);
+  ++(that->_nbPending);
+  // Index the birth
+  if (that->_index != NULL)
+    GAGenealogyAdd(that->_index, birth);
+}
+
+// Get the number of births in the genealogy of the GAHistory 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+long GAHistoryGetNbBirth(const GAHistory* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_nbBirth;
+}
+
+// Get the index of the genealogy of the GAHistory 'that', NULL if the
+// births are not indexed
+#if BUILDMODE != 0
+static inline
+#endif
+GAGenealogy* GAHistoryIndex(const GAHistory* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_index;
+}
+
+// Set the flag indexing the births recorded in the history of the 
+// GenAlg 'that', to query its genealogy while it runs
+#if BUILDMODE != 0
+static inline
+#endif
+void GASetFlagHistoryIndex(GenAlg* const that, const bool flag) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  GAHistorySetFlagIndex(&(that->_history), flag);
+}
+
+// Get the index of the genealogy of the GenAlg 'that', NULL if its 
+// births are not indexed
+#if BUILDMODE != 0
+static inline
+#endif
+GAGenealogy* GAGetHistoryIndex(const GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_history._index;
+}
+
+// Get the number of adns in the GAGenealogy 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+long GAGenealogyGetNbAdn(const GAGenealogy* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_nbNode;
 }
 
 // Set the history recording flag for the GenAlg 'that'
@@ -924,6 +1215,9 @@ bool GAGetFlagHistory(const GenAlg* const that){
 }
 
 // Set the path where the history is recorded for the GenAlg 'that'
+// The history is a binary genealogy log (cf GASaveHistory), its 
+// default path is ./genAlgHistory.bin (./genAlgHistory.json before 
+// the history was saved as a binary log)
 #if BUILDMODE != 0
 static inline
 #endif
@@ -940,9 +1234,16 @@ void GASetHistoryPath(GenAlg* const that, const char* const path) {
     PBErrCatch(GenAlgErr);
   }
 #endif
-  // Set the path
+  // Set the path, the pending births will be written in a new log 
+  // at this path
   free(that->_history._path);
   that->_history._path = strdup(path);
+  if (that->_history._log != NULL) {
+    if (that->_history._writer != NULL)
+      GAIOWriterWait(that->_history._writer);
+    fclose(that->_history._log);
+    that->_history._log = NULL;
+  }
 }
 
 // Get the path where the history is recorded for the GenAlg 'that'
@@ -995,3 +1296,512 @@ unsigned long GAGetMaxAge(GenAlg* const that) {
 
 
 
+
+// Get the flag memorizing if the genes of the adns of the GenAlg 
+// 'that' are stored in contiguous slabs owned by the GenAlg
+#if BUILDMODE != 0
+static inline
+#endif
+bool GAGetFlagContiguousAdn(const GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // Return the flag
+  return (that->_store != NULL);
+}
+
+// Get the number of threads used by GAStep of the GenAlg 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+int GAGetNbThread(const GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_nbThread;
+}
+
+// Get the asynchronous I/O flag of the GenAlg 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+bool GAGetFlagAsyncIO(const GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return (that->_writer != NULL);
+}
+
+// Get the steady state mode flag of the GenAlg 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+bool GAGetFlagSteadyState(const GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return (that->_steady != NULL);
+}
+
+// Return the number of candidates of the GABatch 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+long GABatchGetNb(const GABatch* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_nb;
+}
+
+// Return the id of the 'iCandidate'-th candidate of the GABatch 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+unsigned long GABatchGetId(const GABatch* const that, 
+  const long iCandidate) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (iCandidate < 0 || iCandidate >= that->_nb) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'iCandidate' is invalid (0<=%ld<%ld)",
+      iCandidate, that->_nb);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_ids[iCandidate];
+}
+
+// Return the genes for floating point values of the 'iCandidate'-th 
+// candidate of the GABatch 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+const float* GABatchAdnF(const GABatch* const that, 
+  const long iCandidate) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (iCandidate < 0 || iCandidate >= that->_nb) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'iCandidate' is invalid (0<=%ld<%ld)",
+      iCandidate, that->_nb);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_adnF + iCandidate * that->_lengthAdnF;
+}
+
+// Return the genes for integer values of the 'iCandidate'-th 
+// candidate of the GABatch 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+const long* GABatchAdnI(const GABatch* const that, 
+  const long iCandidate) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (iCandidate < 0 || iCandidate >= that->_nb) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'iCandidate' is invalid (0<=%ld<%ld)",
+      iCandidate, that->_nb);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_adnI + iCandidate * that->_lengthAdnI;
+}
+
+// Return the number of candidates of the GAGenesMatrix 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+long GAGenesMatrixGetNb(const GAGenesMatrix* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_nb;
+}
+
+// Return the number of columns of the GAGenesMatrix 'that', the 
+// columns after GAGenesMatrixGetNb are null and can be evaluated
+// and ignored
+#if BUILDMODE != 0
+static inline
+#endif
+long GAGenesMatrixGetStride(const GAGenesMatrix* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_stride;
+}
+
+// Return the row of the 'iGene'-th gene for floating point values of
+// the GAGenesMatrix 'that', aligned on GENALG_STORE_ALIGN bytes
+#if BUILDMODE != 0
+static inline
+#endif
+const float* GAGenesMatrixAdnF(const GAGenesMatrix* const that, 
+  const long iGene) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (iGene < 0 || iGene >= that->_lengthAdnF) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'iGene' is invalid (0<=%ld<%ld)",
+      iGene, that->_lengthAdnF);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_adnF + iGene * that->_stride;
+}
+
+// Return the row of the 'iGene'-th gene for integer values of the 
+// GAGenesMatrix 'that', aligned on GENALG_STORE_ALIGN bytes
+#if BUILDMODE != 0
+static inline
+#endif
+const long* GAGenesMatrixAdnI(const GAGenesMatrix* const that, 
+  const long iGene) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (iGene < 0 || iGene >= that->_lengthAdnI) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'iGene' is invalid (0<=%ld<%ld)",
+      iGene, that->_lengthAdnI);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_adnI + iGene * that->_stride;
+}
+
+// ------------- GAThreadPool
+
+// ================ Functions implementation ====================
+
+// Get the number of threads of the GAThreadPool 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+int GAThreadPoolGetNbThread(const GAThreadPool* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // Return the number of threads
+  return that->_nbThread;
+}
+
+// ------------- GAIslands
+
+// ================ Functions implementation ====================
+
+// Return the number of islands of the GAIslands 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+int GAIslandsGetNbIsland(const GAIslands* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_nbIsland;
+}
+
+// Return the 'iIsland'-th island of the GAIslands 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+GenAlg* GAIslandsGenAlg(const GAIslands* const that, const int iIsland) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (iIsland < 0 || iIsland >= that->_nbIsland) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'iIsland' is invalid (0<=%d<%d)", 
+      iIsland, that->_nbIsland);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_islands[iIsland];
+}
+
+// Set the topology of the migrations of the GAIslands 'that' to 
+// 'topology'
+#if BUILDMODE != 0
+static inline
+#endif
+void GAIslandsSetTopology(GAIslands* const that, 
+  const GAMigrationTopology topology) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (topology != gaMigrationRing && topology != gaMigrationAllToAll) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'topology' is invalid (%d)", topology);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  that->_topology = topology;
+}
+
+// Return the topology of the migrations of the GAIslands 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+GAMigrationTopology GAIslandsGetTopology(const GAIslands* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_topology;
+}
+
+// Set the number of epochs between two migrations of the GAIslands
+// 'that' to 'period'
+#if BUILDMODE != 0
+static inline
+#endif
+void GAIslandsSetPeriod(GAIslands* const that, 
+  const unsigned long period) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (period < 1) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'period' is invalid (%lu>=1)", period);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  that->_period = period;
+}
+
+// Return the number of epochs between two migrations of the 
+// GAIslands 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+unsigned long GAIslandsGetPeriod(const GAIslands* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_period;
+}
+
+// Set the number of elites sent by an island of the GAIslands 'that' 
+// to each of its destinations to 'nb'
+// If 'nb' is greater than the number of elites of an island, only its
+// elites migrate
+#if BUILDMODE != 0
+static inline
+#endif
+void GAIslandsSetNbMigrant(GAIslands* const that, const int nb) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (nb < 0) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'nb' is invalid (%d>=0)", nb);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  that->_nbMigrant = nb;
+}
+
+// Return the number of elites sent by an island of the GAIslands 
+// 'that' to each of its destinations
+#if BUILDMODE != 0
+static inline
+#endif
+int GAIslandsGetNbMigrant(const GAIslands* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_nbMigrant;
+}
+
+// Return the number of migrations done by the GAIslands 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+unsigned long GAIslandsGetNbMigration(const GAIslands* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_nbMigration;
+}
+
+// ------------- GAWorkerPool
+
+// ================ Functions implementation ====================
+
+// Return the number of workers of the GAWorkerPool 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+int GAWorkerPoolGetNbWorker(const GAWorkerPool* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_nbWorker;
+}
+
+// Set the maximum number of candidates per request of the 
+// GAWorkerPool 'that' to 'maxBatch'
+#if BUILDMODE != 0
+static inline
+#endif
+void GAWorkerPoolSetMaxBatch(GAWorkerPool* const that, 
+  const long maxBatch) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (maxBatch < 1) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'maxBatch' is invalid (%ld>=1)", 
+      maxBatch);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  that->_maxBatch = maxBatch;
+}
+
+// Return the maximum number of candidates per request of the 
+// GAWorkerPool 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+long GAWorkerPoolGetMaxBatch(const GAWorkerPool* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_maxBatch;
+}
+
+// Set the time in ms given to a worker of the GAWorkerPool 'that' to 
+// reply to a request to 'timeout', -1 for unlimited
+#if BUILDMODE != 0
+static inline
+#endif
+void GAWorkerPoolSetTimeout(GAWorkerPool* const that, 
+  const int timeout) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (timeout < -1) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'timeout' is invalid (%d>=-1)", 
+      timeout);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  that->_timeout = timeout;
+}
+
+// Return the time in ms given to a worker of the GAWorkerPool 'that' 
+// to reply to a request, -1 if unlimited
+#if BUILDMODE != 0
+static inline
+#endif
+int GAWorkerPoolGetTimeout(const GAWorkerPool* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  return that->_timeout;
+}
@@ -0,0 +1,47 @@
+// ============ GENALG-WORKER.C ================
+
+// Stub worker of GAWorkerPool, evaluating the candidates it receives
+// on its standard input with the same fitness as evaluate() in main.c
+// Used by the unit tests and the benchmark of GAWorkerPool, to be
+// replaced by the actual fitness of the user
+
+// ================= Include =================
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <unistd.h>
+#include "genalg.h"
+
+// ================ Functions implementation ====================
+
+float ftarget(float x) {
+  return -0.5 * fastpow(x, 3) + 0.314 * fastpow(x, 2) - 0.7777 * x + 0.1;
+}
+
+// Value of the candidate with genes 'adnF' and 'adnI', the float genes
+// are the coefficients and the int genes the exponents of a
+// polynomial approximating ftarget over [-2, 2]
+float evaluate(const float* const adnF, const long lengthAdnF,
+  const long* const adnI, const long lengthAdnI, void* const data) {
+  (void)data;
+  long nbTerm = MIN(lengthAdnF, lengthAdnI);
+  float delta = 0.02;
+  int nb = (int)round(4.0 / delta);
+  float res = 0.0;
+  float x = -2.0;
+  for (int i = 0; i < nb; ++i, x += delta) {
+    float y = 0.0;
+    for (long j = nbTerm; j--;)
+      y += adnF[j] * fastpow(x, adnI[j]);
+    res += fabs(ftarget(x) - y);
+  }
+  return -1.0 * (res / (float)nb);
+}
+
+int main() {
+  // Serve the requests of the pool until it stops the worker
+  bool ret = GAWorkerServe(STDIN_FILENO, evaluate, NULL);
+  // Return the success code
+  return (ret ? 0 : 1);
+}
@@ -2,37 +2,91 @@
 
 // ================= Include =================
 
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <poll.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
 #include "genalg.h"
 #if BUILDMODE == 0
 #include "genalg-inline.c"
 #endif
 
+// ------------- GARng
+
+// ================ Functions declaration ====================
+
+// Step the splitmix64 generator of state 'x' and return its output
+uint64_t GARngSplitMix64(uint64_t* const x);
+
+// ================ Functions implementation ====================
+
+// Return a new GARng for the stream 'stream' of the seed 'seed'
+GARng GARngCreateStatic(const unsigned long seed, 
+  const unsigned long stream) {
+  // Declare the new GARng
+  GARng that;
+  // Mix the seed, then the stream, with splitmix64 to get a well
+  // distributed state different for each stream
+  uint64_t x = seed;
+  x = GARngSplitMix64(&x) ^ (uint64_t)stream;
+  uint64_t a = GARngSplitMix64(&x);
+  uint64_t b = GARngSplitMix64(&x);
+  that._s[0] = (uint32_t)a;
+  that._s[1] = (uint32_t)(a >> 32);
+  that._s[2] = (uint32_t)b;
+  that._s[3] = (uint32_t)(b >> 32);
+  // The null state is the only invalid one
+  if ((a | b) == 0)
+    that._s[0] = 1;
+  // Return the new GARng
+  return that;
+}
+
+// Step the splitmix64 generator of state 'x' and return its output
+uint64_t GARngSplitMix64(uint64_t* const x) {
+  uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
 // ------------- GenAlgAdn
 
 // ================ Functions declaration ====================
 
-// Get the diversity value of 'adnA' against 'adnB'
-// The diversity is equal to 
-float GAAdnGetDiversity(const GenAlgAdn* const adnA, 
-  const GenAlgAdn* const adnB, const GenAlg* const ga);
+// Return the squared euclidean distance between the 'nb' floating 
+// point values 'a' and 'b'
+float GAGetSqDistF(const float* const restrict a, 
+  const float* const restrict b, const long nb);
+
+// Return the squared euclidean distance between the 'nb' integer 
+// values 'a' and 'b'
+float GAGetSqDistI(const long* const restrict a, 
+  const long* const restrict b, const long nb);
 
 // Initialise randomly the genes of the GenAlgAdn 'that' of the 
 // GenAlg 'ga'
-void GAAdnInitDefault(const GenAlgAdn* const that, const GenAlg* ga);
+void GAAdnInitDefault(const GenAlgAdn* const that, const GenAlg* ga,
+  GARng* const rng);
 
 // Initialise randomly the genes of the GenAlgAdn 'that' of the 
 // GenAlg 'ga', version used to calculate the parameters of a NeuraNet
-void GAAdnInitNeuraNet(const GenAlgAdn* const that, const GenAlg* ga);
+void GAAdnInitNeuraNet(const GenAlgAdn* const that, const GenAlg* ga,
+  GARng* const rng);
 
 // Initialise randomly the genes of the GenAlgAdn 'that' of the 
 // GenAlg 'ga', version used to calculate the parameters of a NeuraNet
 // with convolution
 void GAAdnInitNeuraNetConv(const GenAlgAdn* const that, 
-  const GenAlg* const ga);
+  const GenAlg* const ga, GARng* const rng);
     
 // Initialise randomly the genes of the GenAlgAdn 'that' of the 
 // GenAlg 'ga', version used for Morpheus
-void GAAdnInitMorpheus(const GenAlgAdn* const that, const GenAlg* ga);
+void GAAdnInitMorpheus(const GenAlgAdn* const that, const GenAlg* ga,
+  GARng* const rng);
 
 // ================ Functions implementation ====================
 
@@ -60,6 +114,10 @@ GenAlgAdn* GenAlgAdnCreate(const unsigned long id,
   that->_age = 1;
   that->_id = id;
   that->_val = 0.0;
+  that->_iRow = -1;
+  that->_rank = -1;
+  that->_flagCachedVal = false;
+  that->_flagPartialVal = false;
   if (lengthAdnF > 0) {
     that->_adnF = VecFloatCreate(lengthAdnF);
     that->_deltaAdnF = VecFloatCreate(lengthAdnF);
@@ -84,7 +142,13 @@ GenAlgAdn* GenAlgAdnCreate(const unsigned long id,
 void GenAlgAdnFree(GenAlgAdn** that) {
   // Check the argument
   if (that == NULL || *that == NULL) return;
-  // Free memory
+  // Free memory, if the adn is a view in the store of its GenAlg
+  // the vectors are owned by the store
+  if ((*that)->_iRow >= 0) {
+    free(*that);
+    *that = NULL;
+    return;
+  }
   if ((*that)->_adnF != NULL)
     VecFree(&((*that)->_adnF));
   if ((*that)->_deltaAdnF != NULL)
@@ -102,7 +166,7 @@ void GenAlgAdnFree(GenAlgAdn** that) {
 
 // Initialise randomly the genes of the GenAlgAdn 'that' of the 
 // GenAlg 'ga' according to the type of GenAlg
-void GAAdnInit(GenAlgAdn* const that, const GenAlg* const ga) {
+void GAAdnInit(GenAlgAdn* const that, GenAlg* const ga) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
@@ -112,27 +176,30 @@ void GAAdnInit(GenAlgAdn* const that, const GenAlg* const ga) {
 #endif
   switch (GAGetType(ga)) {
     case genAlgTypeNeuraNet:
-      GAAdnInitNeuraNet(that, ga);
+      GAAdnInitNeuraNet(that, ga, &(ga->_rng));
       break;
     case genAlgTypeNeuraNetConv:
-      GAAdnInitNeuraNetConv(that, ga);
+      GAAdnInitNeuraNetConv(that, ga, &(ga->_rng));
       break;
     case genAlgTypeMorpheus:
-      GAAdnInitMorpheus(that, ga);
+      GAAdnInitMorpheus(that, ga, &(ga->_rng));
       break;
     case genAlgTypeDefault:
     default:
-      GAAdnInitDefault(that, ga);
+      GAAdnInitDefault(that, ga, &(ga->_rng));
   }
   // Initialise the parent id, by default itself
   that->_idParents[0] = that->_id;
   that->_idParents[1] = that->_id;
+  // The genes have changed, the value is not the cached one anymore
+  that->_flagCachedVal = false;
+  that->_flagPartialVal = false;
 }
 
 // Initialise randomly the genes of the GenAlgAdn 'that' of the 
 // GenAlg 'ga'
 void GAAdnInitDefault(const GenAlgAdn* const that, 
-  const GenAlg* const ga) {
+  const GenAlg* const ga, GARng* const rng) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
@@ -144,7 +211,7 @@ void GAAdnInitDefault(const GenAlgAdn* const that,
   for (long iGene = GAGetLengthAdnFloat(ga); iGene--;) {
     float min = VecGet(GABoundsAdnFloat(ga, iGene), 0);
     float max = VecGet(GABoundsAdnFloat(ga, iGene), 1);
-    float val = min + (max - min) * rnd();
+    float val = min + (max - min) * GARngUnif(rng);
     VecSet(that->_adnF, iGene, val);
     VecSet(that->_mutabilityF, iGene, 1.0);
   }
@@ -152,7 +219,8 @@ void GAAdnInitDefault(const GenAlgAdn* const that,
   for (long iGene = GAGetLengthAdnInt(ga); iGene--;) {
     long min = VecGet(GABoundsAdnInt(ga, iGene), 0);
     long max = VecGet(GABoundsAdnInt(ga, iGene), 1);
-    long val = (long)round((float)min + (float)(max - min) * rnd());
+    long val = 
+      (long)round((float)min + (float)(max - min) * GARngUnif(rng));
     VecSet(that->_adnI, iGene, val);
     VecSet(that->_mutabilityI, iGene, 1.0);
   }
@@ -162,7 +230,7 @@ void GAAdnInitDefault(const GenAlgAdn* const that,
 // GenAlg 'ga', version used to calculate the parameters of a NeuraNet
 // with convolution
 void GAAdnInitNeuraNetConv(const GenAlgAdn* const that, 
-  const GenAlg* const ga) {
+  const GenAlg* const ga, GARng* const rng) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
@@ -174,7 +242,7 @@ void GAAdnInitNeuraNetConv(const GenAlgAdn* const that,
   for (long iGene = GAGetLengthAdnFloat(ga); iGene--;) {
     float min = VecGet(GABoundsAdnFloat(ga, iGene), 0);
     float max = VecGet(GABoundsAdnFloat(ga, iGene), 1);
-    float val = min + (max - min) * rnd();
+    float val = min + (max - min) * GARngUnif(rng);
     VecSet(that->_adnF, iGene, val);
     VecSet(that->_mutabilityF, iGene, 1.0);
   }
@@ -182,7 +250,8 @@ void GAAdnInitNeuraNetConv(const GenAlgAdn* const that,
 
 // Initialise randomly the genes of the GenAlgAdn 'that' of the 
 // GenAlg 'ga', version used to calculate the parameters of a NeuraNet
-void GAAdnInitNeuraNet(const GenAlgAdn* const that, const GenAlg* ga) {
+void GAAdnInitNeuraNet(const GenAlgAdn* const that, const GenAlg* ga,
+  GARng* const rng) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
@@ -195,7 +264,7 @@ void GAAdnInitNeuraNet(const GenAlgAdn* const that, const GenAlg* ga) {
   for (long iGene = GAGetLengthAdnFloat(ga); iGene--;) {
     float min = VecGet(GABoundsAdnFloat(ga, iGene), 0);
     float max = VecGet(GABoundsAdnFloat(ga, iGene), 1);
-    float val = min + (max - min) * rnd();
+    float val = min + (max - min) * GARngUnif(rng);
     VecSet(that->_adnF, iGene, val);
     VecSet(that->_mutabilityF, iGene, 1.0);
   }
@@ -214,12 +283,14 @@ void GAAdnInitNeuraNet(const GenAlgAdn* const that, const GenAlg* ga) {
       // inactive link
       long min = 0;
       long max = VecGet(GABoundsAdnInt(ga, iOut * 3), 1);
-      long val = (long)round((float)min + (float)(max - min) * rnd());
+      long val = 
+        (long)round((float)min + (float)(max - min) * GARngUnif(rng));
       VecSet(that->_adnI, iOut * 3, val);
       // The start of the link is randomly choosen amongst inputs
       min = 0;
       max = ga->_NNdata._nbIn - 1;
-      val = (long)round((float)min + (float)(max - min) * rnd());
+      val = 
+        (long)round((float)min + (float)(max - min) * GARngUnif(rng));
       VecSet(that->_adnI, iOut * 3 + 1, val);
       // The end of the link is choosen sequencially amongst outputs
       VecSet(that->_adnI, iOut * 3 + 2, iOut + shiftOut);
@@ -230,7 +301,7 @@ void GAAdnInitNeuraNet(const GenAlgAdn* const that, const GenAlg* ga) {
 // Initialise randomly the genes of the GenAlgAdn 'that' of the 
 // GenAlg 'ga', version used for Morpheus
 void GAAdnInitMorpheus(const GenAlgAdn* const that, 
-  const GenAlg* const ga) {
+  const GenAlg* const ga, GARng* const rng) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
@@ -246,7 +317,7 @@ void GAAdnInitMorpheus(const GenAlgAdn* const that,
       long iGene = jGene + i;
       float min = VecGet(GABoundsAdnFloat(ga, iGene), 0);
       float max = VecGet(GABoundsAdnFloat(ga, iGene), 1);
-      float val = min + (max - min) * rnd();
+      float val = min + (max - min) * GARngUnif(rng);
       VecSet(that->_adnF, iGene, val);
       VecSet(that->_mutabilityF, iGene, 1.0);
     }
@@ -296,68 +367,511 @@ void GAAdnPrintln(const GenAlgAdn* const that, FILE* const stream) {
 
 // Select the rank of two parents for the SRM algorithm
 // Return the ranks in 'parents', with parents[0] <= parents[1]
-void GASelectParents(const GenAlg* const that, int* const parents);
+void GASelectParents(const GenAlg* const that, int* const parents,
+  GARng* const rng);
 
 // Set the genes of the entity at rank 'iChild' as a 50/50 mix of the 
 // genes of entities at ranks 'parents[0]' and 'parents[1]'
 void GAReproduction(GenAlg* const that, const int* const parents, 
-  const int iChild);
+  const int iChild, GARng* const rng);
 
 // Set the genes of the entity at rank 'iChild' as a 50/50 mix of the 
 // genes of entities at ranks 'parents[0]' and 'parents[1]'
 void GAReproductionDefault(GenAlg* const that, 
-  const int* const parents, const int iChild);
+  const int* const parents, const int iChild, GARng* const rng);
 
 // Set the genes of the adn at rank 'iChild' as a mix of the 
 // genes of adns at ranks 'parents[0]' and 'parents[1]'
 // Version used for Morpheus, links topology stays the same, base
 // functions are averaged betwen parent
 void GAReproductionMorpheus(GenAlg* const that, 
-  const int* const parents, const int iChild);
+  const int* const parents, const int iChild, GARng* const rng);
 
 // Set the genes of the adn at rank 'iChild' as a 50/50 mix of the 
 // genes of adns at ranks 'parents[0]' and 'parents[1]'
 // This version is optimised to calculate the parameters of a NeuraNet
 // with convolution by inheriting whole bases from parents
 void GAReproductionNeuraNetConv(GenAlg* const that, 
-  const int* const parents, const int iChild);
+  const int* const parents, const int iChild, GARng* const rng);
   
 // Set the genes of the entity at rank 'iChild' as a 50/50 mix of the 
 // genes of entities at ranks 'parents[0]' and 'parents[1]'
 // This version is optimised to calculate the parameters of a NeuraNet
 // by inheriting whole bases and links from parents
 void GAReproductionNeuraNet(GenAlg* const that, 
-  const int* const parents, const int iChild);
+  const int* const parents, const int iChild, GARng* const rng);
 
 // Router toward the appropriate Mute function according to the type 
 // of GenAlg
+// 'iThread' is the index of the thread executing the mutation
 void GAMute(GenAlg* const that, const int* const parents, 
-  const int iChild);
+  const int iChild, GARng* const rng, const int iThread);
   
 // Mute the genes of the entity at rank 'iChild'
 void GAMuteDefault(GenAlg* const that, const int* const parents, 
-  const int iChild);
+  const int iChild, GARng* const rng);
+
+// Mute the 'nb' floating point genes 'adn' with deltas 'delta' and 
+// bounds 'min', 'max', using the random values 'draw' (the gene 
+// mutes if its draw is below 'probMute') and 'noise' (in [-0.5,0.5[)
+// and the amplitude 'amp'
+// Genes out of bounds after mutation are reflected into the bounds
+// Return the number of muted genes
+long GAMuteKernelF(float* const restrict adn, 
+  float* const restrict delta, const float* const restrict min, 
+  const float* const restrict max, const float* const restrict draw, 
+  const float* const restrict noise, const float probMute, 
+  const float amp, const long nb);
+
+// Sampler of the indices of the genes mutating with a given 
+// probability, by drawing the distance to the next mutating gene
+typedef struct GAMuteSampler {
+  // Number of genes
+  long _nb;
+  // Logarithm of the probability of a gene to not mute
+  double _logNoMute;
+  // Index of the current mutating gene
+  long _iGene;
+} GAMuteSampler;
+
+// Start the GAMuteSampler 'that' for 'nb' genes mutating with the 
+// probability 'prob' (in ]0,1[) and return the index of the first 
+// mutating gene
+// The first index is drawn conditionally to at least one mutation, 
+// so it is always lower than 'nb'
+long GAMuteSamplerFirst(GAMuteSampler* const that, GARng* const rng,
+  const float prob, const long nb);
+
+// Return the index of the next mutating gene of the GAMuteSampler 
+// 'that', or its number of genes if there is no more mutating gene
+long GAMuteSamplerNext(GAMuteSampler* const that, GARng* const rng);
+
+// Mute the 'iGene'-th gene for floating point values of the 
+// GenAlgAdn 'child' of the GenAlg 'that' with the amplitude 'amp'
+void GAMuteGeneF(const GenAlg* const that, GenAlgAdn* const child, 
+  const long iGene, const float amp, GARng* const rng);
+
+// Mute the 'iGene'-th gene for integer values of the GenAlgAdn 
+// 'child' of the GenAlg 'that' with the amplitude 'amp'
+void GAMuteGeneI(const GenAlg* const that, GenAlgAdn* const child, 
+  const long iGene, const float amp, GARng* const rng);
 
 // Mute the genes of the entity at rank 'iChild'
 // Version for Morpheus
 void GAMuteMorpheus(GenAlg* const that, const int* const parents, 
-  const int iChild);
+  const int iChild, GARng* const rng);
 
 // Mute the genes of the entity at rank 'iChild'
 // This version is optimised to calculate the parameters of a NeuraNet
 // by ensuring coherence in links: outputs have at least one link
 // and there is no dead link
+// Use the scratch memory of the thread 'iThread'
 void GAMuteNeuraNet(GenAlg* const that, const int* const parents, 
-  const int iChild);
+  const int iChild, GARng* const rng, const int iThread);
 
 // Mute the genes of the entity at rank 'iChild'
 // This version is optimised to calculate the parameters of a NeuraNet
 // with convolution by muting bases function per cell
 void GAMuteNeuraNetConv(GenAlg* const that, const int* const parents, 
-  const int iChild);
+  const int iChild, GARng* const rng);
 
 // Refresh the content of the TextOMeter attached to the GenAlg 'that'
 void GAUpdateTextOMeter(const GenAlg* const that);
+
+// Create a new empty GAAdnStore for adns of length 'lengthAdnF' and 
+// 'lengthAdnI'
+GAAdnStore* GAAdnStoreCreate(const long lengthAdnF, 
+  const long lengthAdnI);
+
+// Free the memory used by the GAAdnStore 'that'
+void GAAdnStoreFree(GAAdnStore** that);
+
+// Reallocate the slab 'slab' of 'nbRow' rows of 'stride' bytes to
+// 'nbRowNew' rows
+char* GAAdnStoreSlabResize(char* const slab, const size_t stride, 
+  const long nbRow, const long nbRowNew);
+
+// Ensure the store of the GenAlg 'that' has at least 'nbRow' rows
+// The views of the adns currently in the store are updated if the 
+// slabs are moved
+void GAAdnStoreReserve(GenAlg* const that, const long nbRow);
+
+// Move the genes of the GenAlgAdn 'adn' into a row of the store of 
+// the GenAlg 'that', the previous vectors of 'adn' are freed
+void GAAdnStoreAttach(GenAlg* const that, GenAlgAdn* const adn);
+
+// Move the genes of the GenAlgAdn 'adn' out of the store of the 
+// GenAlg 'that' into vectors owned by 'adn'
+void GAAdnStoreDetach(GenAlg* const that, GenAlgAdn* const adn);
+
+// Give back the row of the GenAlgAdn 'adn' to the store of the 
+// GenAlg 'that', the vectors of 'adn' are set to null
+void GAAdnStoreRelease(GenAlg* const that, GenAlgAdn* const adn);
+
+// Point the vectors of the GenAlgAdn 'adn' to its row in the 
+// GAAdnStore 'that'
+void GAAdnStorePoint(const GAAdnStore* const that, 
+  GenAlgAdn* const adn);
+
+// Data shared by the threads of GAEvaluate
+typedef struct GAEvalJob {
+  // Adns to evaluate
+  GenAlgAdn** _adns;
+  // Values of the adns
+  float* _vals;
+  // Evaluation function and its user data
+  GAEvalFun _fun;
+  void* _data;
+} GAEvalJob;
+
+// Evaluate the 'iTask'-th adn of the GAEvalJob 'data' from the 
+// thread 'iThread'
+void GAEvaluateTask(void* const data, const long iTask, 
+  const int iThread);
+
+// Ensure the pool of threads of the GenAlg 'that' exists and has 
+// 'nbThread' threads
+void GAPrepareThreadPool(GenAlg* const that, const int nbThread);
+
+// Ensure the GAGenesMatrix 'that' can hold 'nb' candidates with genes
+// of length 'lengthAdnF' and 'lengthAdnI', and null its columns
+void GAGenesMatrixPrepare(GAGenesMatrix* const that, const long nb, 
+  const long lengthAdnF, const long lengthAdnI);
+
+// Insert the value 'val' in the 'nbBest' values 'best' sorted from 
+// the best, keeping at most 'nbMax' values
+void GARaceInsertBest(float* const best, int* const nbBest, 
+  const int nbMax, const float val);
+
+// Data shared by the threads of GAEvaluateRace
+typedef struct GARaceJob {
+  // Adns to evaluate
+  GenAlgAdn** _adns;
+  // Values of the adns, flags of the aborted evaluations and number 
+  // of test cases evaluated per adn
+  float* _vals;
+  bool* _flagPartial;
+  long* _nbEvalCase;
+  // Evaluation function and its user data
+  GARaceFun _fun;
+  void* _data;
+  // Test cases
+  long _nbCase;
+  long _sizeChunk;
+  float _maxCase;
+  // Mutex protecting the values of the best adns already evaluated, 
+  // sorted from the best, the last one is the value to beat once 
+  // there are as many as elites
+  pthread_mutex_t _mutex;
+  float* _best;
+  int _nbBest;
+  int _nbElite;
+} GARaceJob;
+
+// Evaluate the 'iTask'-th adn of the GARaceJob 'data' from the 
+// thread 'iThread'
+void GAEvaluateRaceTask(void* const data, const long iTask, 
+  const int iThread);
+
+// Ensure the GenAlg 'that' has the scratch memory of 'nbThread' 
+// threads, sized for its current type
+void GAPrepareScratch(GenAlg* const that, const int nbThread);
+
+// Return the lowest rank of the adns reset by a KT event of the 
+// GenAlg 'that': the elites more diverse than the worst elite are 
+// kept, the best adn is always kept
+int GAKTEventGetRankMin(const GenAlg* const that);
+
+// End the current epoch of the GenAlg 'that' in steady state mode: 
+// update the ages of the elites and check the KT event
+void GASteadyStateEndEpoch(GenAlg* const that);
+
+// Gather the new adns of the current epoch of the GenAlg 'that' for 
+// GAAsk, stepping the epochs without new adns
+void GAAskGather(GenAlg* const that);
+
+// Forget the adns gathered by the ask/tell state 'that', the batches 
+// given until now become obsolete
+void GAAskTellReset(GAAskTell* const that);
+
+// Kill the adn at rank 'iRank' of the GenAlg 'that' in steady state 
+// mode: its genes are reinitialised and it gets the lowest value
+// The ranks must be updated after
+void GASteadyStateKill(GenAlg* const that, const int iRank);
+
+// Free the memory used by the GAFitnessCache 'that' and disable it
+void GAFitnessCacheFree(GAFitnessCache* const that);
+
+// Return the hash of the genes of the GenAlgAdn 'adn'
+uint64_t GAFitnessCacheHash(const GAFitnessCache* const that, 
+  const GenAlgAdn* const adn);
+
+// Search the genes of the GenAlgAdn 'adn' with hash 'hash' in the 
+// GAFitnessCache 'that'
+// Return the index of the entry, or -1 if it is not in the cache
+int GAFitnessCacheSearch(const GAFitnessCache* const that, 
+  const GenAlgAdn* const adn, const uint64_t hash);
+
+// Move the entry 'iEntry' of the GAFitnessCache 'that' to the head
+// of the order of use
+void GAFitnessCacheTouch(GAFitnessCache* const that, const int iEntry);
+
+// Record the value of the GenAlgAdn 'adn' in the GAFitnessCache 
+// 'that', replacing the least recently used entry if the cache is 
+// full
+void GAFitnessCachePut(GAFitnessCache* const that, 
+  const GenAlgAdn* const adn);
+
+// Look up the GenAlgAdn 'adn' in the GAFitnessCache 'that'
+// Return true and set 'val' to its value if found, else return false
+bool GAFitnessCacheGet(GAFitnessCache* const that, 
+  const GenAlgAdn* const adn, float* const val);
+
+// Maximum depth of the JSON written with a GAJSONStream
+#define GENALG_JSONSTREAM_DEPTH 8
+
+// Writer of JSON encoding directly on a stream, with the same layout
+// as JSONSave, used to save a GenAlg without creating its JSONNode
+typedef struct GAJSONStream {
+  // Stream where the JSON is written
+  FILE* _stream;
+  // Flag for the compact form
+  bool _compact;
+  // Depth of the current node
+  int _depth;
+  // Flag for each depth, true if the current node at this depth has
+  // no child yet
+  bool _isEmpty[GENALG_JSONSTREAM_DEPTH];
+} GAJSONStream;
+
+// Open a node (object if 'c' equals '{', array if 'c' equals '[') in 
+// the GAJSONStream 'that'
+void GAJSONStreamOpen(GAJSONStream* const that, const char c);
+
+// Close the current node (with 'c' equals '}' or ']') in the 
+// GAJSONStream 'that'
+void GAJSONStreamClose(GAJSONStream* const that, const char c);
+
+// Start a new child of the current node in the GAJSONStream 'that'
+void GAJSONStreamNext(GAJSONStream* const that);
+
+// Start the property 'key' of the current object in the GAJSONStream
+// 'that'
+void GAJSONStreamKey(GAJSONStream* const that, const char* const key);
+
+// Write the property 'key' with value 'val' in the current object of
+// the GAJSONStream 'that'
+void GAJSONStreamProp(GAJSONStream* const that, const char* const key,
+  const char* const val);
+
+// Write the VecFloat 'vec' in the GAJSONStream 'that', with the same 
+// encoding as VecEncodeAsJSON
+void GAJSONStreamVecFloat(GAJSONStream* const that, 
+  const VecFloat* const vec);
+
+// Write the VecLong 'vec' in the GAJSONStream 'that', with the same 
+// encoding as VecEncodeAsJSON
+void GAJSONStreamVecLong(GAJSONStream* const that, 
+  const VecLong* const vec);
+
+// Write the GenAlgAdn 'adn' with sort value 'elo' in the GAJSONStream 
+// 'that', with the same encoding as GAAdnEncodeAsJSON
+void GAJSONStreamAdn(GAJSONStream* const that, 
+  const GenAlgAdn* const adn, const float elo);
+
+// Constant used to check the endianness of the binary snapshots
+#define GENALG_SNAPSHOT_ENDIAN 0x01020304
+
+// Header of the binary snapshots of GenAlg, followed by:
+// the min and max bounds of the float genes (float[lengthAdnF] each),
+// the bounds of the int genes (int64_t[lengthAdnI][2]),
+// a GASnapshotAdn per adn from the head to the tail of the set and 
+// for the best adn, then for the same adns the slabs of float genes 
+// (float[lengthAdnF] each), delta float genes (float[lengthAdnF] 
+// each) and int genes (int64_t[lengthAdnI] each)
+typedef struct GASnapshotHeader {
+  // GENALG_SNAPSHOT_MAGIC
+  char _magic[8];
+  // GENALG_SNAPSHOT_VERSION
+  uint32_t _version;
+  // GENALG_SNAPSHOT_ENDIAN in the native endianness of the writer
+  uint32_t _endian;
+  // Properties of the GenAlg
+  int32_t _type;
+  int32_t _nbAdns;
+  int32_t _nbElites;
+  int32_t _nbIn;
+  int32_t _nbHid;
+  int32_t _nbOut;
+  int32_t _flagMutableLink;
+  int32_t _padding;
+  int64_t _lengthAdnF;
+  int64_t _lengthAdnI;
+  int64_t _nbBaseConv;
+  int64_t _nbBaseCellConv;
+  int64_t _nbLink;
+  uint64_t _curEpoch;
+  uint64_t _nextId;
+  uint64_t _seed;
+  // Total size of the snapshot in bytes
+  uint64_t _size;
+} GASnapshotHeader;
+
+// Properties of an adn in the binary snapshots of GenAlg
+typedef struct GASnapshotAdn {
+  uint64_t _id;
+  uint64_t _age;
+  float _val;
+  float _elo;
+} GASnapshotAdn;
+
+// Return the size in bytes of the binary snapshot described by 
+// 'header'
+uint64_t GASnapshotGetSize(const GASnapshotHeader* const header);
+
+// Return true if the header 'header' of binary snapshot is valid and 
+// describes a snapshot of at most 'size' bytes, else false
+bool GASnapshotCheckHeader(const GASnapshotHeader* const header, 
+  const size_t size);
+
+// Return the adn saved in the 'iRow'-th row of the binary snapshot 
+// of the GenAlg 'that', and its sort value in 'elo'
+const GenAlgAdn* GASnapshotGetAdn(const GenAlg* const that, 
+  const long iRow, float* const elo);
+
+// Write the id, age, value and sort value of the adns of the GenAlg
+// 'that' in the stream 'stream', as in its binary snapshot
+// Return true in case of success, else false
+bool GASnapshotWriteAdns(const GenAlg* const that, FILE* const stream);
+
+// Write the slabs of genes of the 'nb' rows 'iRows' (all the rows if 
+// 'iRows' is null) of the binary snapshot of the GenAlg 'that' in the
+// stream 'stream'
+// Return true in case of success, else false
+bool GASnapshotWriteGenes(const GenAlg* const that, FILE* const stream,
+  const int64_t* const iRows, const long nb);
+
+// Decode the binary snapshot 'data' of 'size' bytes into the GenAlg 
+// 'that' and set 'sizeSnapshot' to the number of bytes used
+// Return true in case of success, else false
+bool GASnapshotDecode(GenAlg** that, const char* const data, 
+  const size_t size, uint64_t* const sizeSnapshot);
+
+// Header of the delta checkpoints of GenAlg, followed by:
+// a GASnapshotAdn per adn from the head to the tail of the set and 
+// for the best adn, the indices (int64_t) of the '_nbChanged' rows
+// whose genes are saved, then for these rows the slabs of genes as in 
+// the binary snapshots
+typedef struct GADeltaHeader {
+  // GENALG_DELTA_MAGIC
+  char _magic[8];
+  // GENALG_SNAPSHOT_VERSION
+  uint32_t _version;
+  // GENALG_SNAPSHOT_ENDIAN in the native endianness of the writer
+  uint32_t _endian;
+  // Properties of the GenAlg
+  int32_t _nbAdns;
+  int32_t _nbElites;
+  int64_t _lengthAdnF;
+  int64_t _lengthAdnI;
+  uint64_t _curEpoch;
+  uint64_t _nextId;
+  uint64_t _seed;
+  // Number of rows whose genes are saved
+  int64_t _nbChanged;
+  // Total size of the delta in bytes
+  uint64_t _size;
+} GADeltaHeader;
+
+// Return the size in bytes of the delta checkpoint described by 
+// 'header'
+uint64_t GADeltaGetSize(const GADeltaHeader* const header);
+
+// Return true if the header 'header' of delta checkpoint is valid 
+// for the GenAlg 'that' and describes a delta of at most 'size' 
+// bytes, else false
+bool GADeltaCheckHeader(const GenAlg* const that, 
+  const GADeltaHeader* const header, const size_t size);
+
+// Write the checkpoint of the GenAlg 'that' in the stream 'stream' 
+// (cf GASaveCheckpoint)
+// Return true in case of success, else false
+bool GACheckpointWrite(GenAlg* const that, FILE* const stream);
+
+// Memorize the ids of the adns of the GenAlg 'that' as the ones of 
+// the last checkpoint
+void GACheckpointMemorize(GenAlg* const that);
+
+// Return true if the id 'id' was in the last checkpoint 'that'
+bool GACheckpointHasId(const GACheckpoint* const that, 
+  const unsigned long id);
+
+// Comparison function of ids for qsort and bsearch
+int GACmpId(const void* const a, const void* const b);
+
+// Comparison function of GASelectItem for qsort, by value and then by
+// position to get the same order as the stable GSetSort
+int GACmpSelectItem(const void* const a, const void* const b);
+
+// Partition the 'nb' GASelectItem 'items' such as the 'nth' one is 
+// the one it would be if they were sorted, the ones before it are 
+// lower and the ones after it are greater
+void GASelectNth(GASelectItem* const items, const long nb, 
+  const long nth);
+
+// Comparison function of GenAlgAdn pointers by id for qsort and 
+// bsearch
+int GACmpAdnId(const void* const a, const void* const b);
+
+// Apply the delta checkpoint 'data' of 'size' bytes to the GenAlg 
+// 'that'
+// Return true in case of success, else false
+bool GADeltaDecode(GenAlg* const that, const char* const data, 
+  const size_t size);
+
+// Header of the binary genealogy logs, followed by the births as 
+// records of four uint64_t: epoch, father, mother and child
+typedef struct GAHistoryLogHeader {
+  // GENALG_HISTORY_MAGIC, null terminated
+  char _magic[8];
+  // GENALG_HISTORY_VERSION
+  uint32_t _version;
+  // GENALG_SNAPSHOT_ENDIAN in the native endianness of the writer
+  uint32_t _endian;
+} GAHistoryLogHeader;
+
+// Copy the pending births of the GAHistory 'that' (preceded by the 
+// header of the log if it's not created yet) and queue them to its 
+// writer
+// Return true if the log could be opened, false else
+bool GAHistoryPush(GAHistory* const that);
+
+// Release the ring buffer of pending births of the GAHistory 'that' 
+// if it's empty and has grown, it's reallocated at the next birth
+void GAHistoryShrink(GAHistory* const that);
+
+// Add the birth of 'idChild' from 'idFather' and 'idMother' at epoch 
+// 'epoch' to the genealogy of the GAHistory 'that'
+void GAHistoryAddBirth(GAHistory* const that, const unsigned long epoch,
+  const unsigned long idFather, const unsigned long idMother, 
+  const unsigned long idChild);
+
+// Read and check the header of the binary genealogy log 'stream'
+// Return true if the header is valid, else false
+bool GAHistoryReadLogHeader(FILE* const stream);
+
+// Read at most 'nb' births from the binary genealogy log 'stream' 
+// into 'births'
+// Return the number of births read, or -1 if the log is truncated
+long GAHistoryReadLog(FILE* const stream, GAHistoryBirth* const births,
+  const long nb);
+
+// Select the parents, reproduce and mute the 'iChild'-th child of the
+// GenAlg 'data' (the adn at rank nbElites + 'iChild') during GAStep
+// Each child uses its own random generator stream, so the result 
+// doesn't depend on the thread 'iThread' executing it
+void GAStepChild(void* const data, const long iChild, 
+  const int iThread);
   
 // ================ Functions implementation ====================
 
@@ -372,6 +886,7 @@ GenAlg* GenAlgCreate(const int nbEntities, const int nbElites,
   GenAlg* that = PBErrMalloc(GenAlgErr, sizeof(GenAlg));
   // Set the properties
   that->_type = genAlgTypeDefault;
+  that->_NNdata = (GANeuraNet){0};
   that->_adns = GSetCreate();
   that->_curEpoch = 0;
   that->_nbKTEvent = 0;
@@ -386,10 +901,20 @@ GenAlg* GenAlgCreate(const int nbEntities, const int nbElites,
   if (lengthAdnF > 0) {
     that->_boundsF = 
       PBErrMalloc(GenAlgErr, sizeof(VecFloat2D) * lengthAdnF);
-    for (long iGene = lengthAdnF; iGene--;)
+    that->_boundsMinF = 
+      PBErrMalloc(GenAlgErr, sizeof(float) * lengthAdnF);
+    that->_boundsMaxF = 
+      PBErrMalloc(GenAlgErr, sizeof(float) * lengthAdnF);
+    for (long iGene = lengthAdnF; iGene--;) {
       that->_boundsF[iGene] = VecFloatCreateStatic2D();
-  } else
+      that->_boundsMinF[iGene] = 0.0;
+      that->_boundsMaxF[iGene] = 0.0;
+    }
+  } else {
     that->_boundsF = NULL;
+    that->_boundsMinF = NULL;
+    that->_boundsMaxF = NULL;
+  }
   if (lengthAdnI > 0) {
     that->_boundsI = 
       PBErrMalloc(GenAlgErr, sizeof(VecLong2D) * lengthAdnI);
@@ -401,6 +926,26 @@ GenAlg* GenAlgCreate(const int nbEntities, const int nbElites,
   that->_normRangeInt = 1.0;
   that->_nbElites = 0;
   that->_nextId = 0;
+  that->_store = NULL;
+  that->_ranks = NULL;
+  that->_nbMaxRank = 0;
+  that->_selection = NULL;
+  that->_nbMaxSelection = 0;
+  that->_scratch = NULL;
+  that->_nbScratch = 0;
+  that->_steady = NULL;
+  that->_askTell = (GAAskTell){0};
+  pthread_mutex_init(&(that->_askTell._mutex), NULL);
+  that->_matrix = (GAGenesMatrix){0};
+  that->_pool = NULL;
+  that->_nbThread = 1;
+  that->_eliteDiversity = (GAEliteDiversity){0};
+  that->_flagEliteDiversity = false;
+  that->_fitnessCache = (GAFitnessCache){0};
+  that->_checkpoint = (GACheckpoint){0};
+  that->_writer = NULL;
+  // By default the seed is drawn from the standard random generator
+  GASetSeed(that, (unsigned long)random());
   GASetNbEntities(that, nbEntities);
   GASetNbElites(that, nbElites);
   that->_history = GAHistoryCreateStatic();
@@ -421,14 +966,39 @@ void GenAlgFree(GenAlg** that) {
     GenAlgAdnFree(&gaEnt);
   } while (GSetIterStep(&iter));
   GSetFree(&((*that)->_adns));
+  GAAdnStoreFree(&((*that)->_store));
+  free((*that)->_ranks);
+  free((*that)->_selection);
+  for (int iThread = 0; iThread < (*that)->_nbScratch; ++iThread)
+    free((*that)->_scratch[iThread]._isUsed);
+  free((*that)->_scratch);
+  GASetFlagSteadyState(*that, false);
+  free((*that)->_askTell._toAsk);
+  pthread_mutex_destroy(&((*that)->_askTell._mutex));
+  free((*that)->_matrix._adnF);
+  free((*that)->_matrix._adnI);
+  free((*that)->_matrix._scores);
+  GAThreadPoolFree(&((*that)->_pool));
+  free((*that)->_eliteDiversity._div);
+  free((*that)->_eliteDiversity._ids);
+  free((*that)->_eliteDiversity._flagUpToDate);
+  free((*that)->_eliteDiversity._adns);
+  free((*that)->_eliteDiversity._newAdns);
+  GAFitnessCacheFree(&((*that)->_fitnessCache));
+  free((*that)->_checkpoint._ids);
   if ((*that)->_boundsF != NULL)
     free((*that)->_boundsF);
+  free((*that)->_boundsMinF);
+  free((*that)->_boundsMaxF);
   if ((*that)->_boundsI != NULL)
     free((*that)->_boundsI);
   GenAlgAdnFree(&((*that)->_bestAdn));
   if ((*that)->_textOMeter != NULL) {
     TextOMeterFree(&((*that)->_textOMeter));
   }
+  // Stop the writer thread first, the remaining births of the 
+  // history are then written synchronously
+  GASetFlagAsyncIO(*that, false);
   GAHistoryFree(&((*that)->_history));
   free(*that);
   // Set the pointer to null
@@ -453,14 +1023,27 @@ void GASetNbEntities(GenAlg* const that, const int nb) {
 #endif
   while (GSetNbElem(GAAdns(that)) > nb) {
     GenAlgAdn* gaEnt = GSetPop(GAAdns(that));
+    if (that->_store != NULL)
+      GAAdnStoreRelease(that, gaEnt);
     GenAlgAdnFree(&gaEnt);
   }
+  if (that->_store != NULL)
+    GAAdnStoreReserve(that, nb);
   while (GSetNbElem(GAAdns(that)) < nb) {
-    GenAlgAdn* ent = GenAlgAdnCreate(that->_nextId,
-      GAGetLengthAdnFloat(that), GAGetLengthAdnInt(that));
+    GenAlgAdn* ent = NULL;
+    // If the genes are in the store, the adn is created without 
+    // vectors and becomes a view on a row of the store
+    if (that->_store != NULL) {
+      ent = GenAlgAdnCreate(that->_nextId, 0, 0);
+      GAAdnStoreAttach(that, ent);
+    } else {
+      ent = GenAlgAdnCreate(that->_nextId,
+        GAGetLengthAdnFloat(that), GAGetLengthAdnInt(that));
+    }
     that->_nextId++;
     GSetPush(GAAdns(that), ent);
   }
+  GAUpdateRanks(that);
   if (GAGetNbElites(that) >= nb)
     GASetNbElites(that, nb - 1);
 }
@@ -486,10 +1069,570 @@ void GASetNbElites(GenAlg* const that, const int nb) {
   that->_nbElites = nb;
 }
 
+// Update the rank index of the GenAlg 'that' from the current order 
+// of its GSet of adns
+// Must be called if the GSet of adns is modified by the user
+void GAUpdateRanks(GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // Ensure the index is large enough
+  int nbAdn = GSetNbElem(GAAdns(that));
+  if (nbAdn > that->_nbMaxRank) {
+    that->_nbMaxRank = MAX(nbAdn, GAGetNbMaxAdn(that));
+    free(that->_ranks);
+    that->_ranks = PBErrMalloc(GenAlgErr, 
+      sizeof(GSetElem*) * that->_nbMaxRank);
+  }
+  if (nbAdn == 0)
+    return;
+  // Loop on the adns from the best (tail) to the worst (head)
+  GSetIterBackward iter = GSetIterBackwardCreateStatic(GAAdns(that));
+  int iRank = 0;
+  do {
+    GSetElem* elem = GSetIterGetElem(&iter);
+    that->_ranks[iRank] = elem;
+    ((GenAlgAdn*)GSetElemData(elem))->_rank = iRank;
+    ++iRank;
+  } while (GSetIterStep(&iter));
+}
+
+// Reorder the GSet of adns of the GenAlg 'that' such as its 'nb' best
+// adns are sorted at its tail, the other adns being at its head in 
+// unspecified order, and update the rank index
+// The ranks lower than 'nb' are the same as after a full GSetSort, at 
+// the cost of a partial selection instead of a sort
+void GASelectBest(GenAlg* const that, const int nb) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (nb < 0) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'nb' is invalid (%d>=0)", nb);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  int nbAdn = GSetNbElem(GAAdns(that));
+  if (nbAdn > 1) {
+    // Ensure the array of scores is large enough
+    if (nbAdn > that->_nbMaxSelection) {
+      that->_nbMaxSelection = MAX(nbAdn, GAGetNbMaxAdn(that));
+      free(that->_selection);
+      that->_selection = PBErrMalloc(GenAlgErr, 
+        sizeof(GASelectItem) * that->_nbMaxSelection);
+    }
+    // Copy the scores of the adns in the contiguous array
+    GASelectItem* items = that->_selection;
+    GSetIterForward iter = GSetIterForwardCreateStatic(GAAdns(that));
+    long iItem = 0;
+    do {
+      GSetElem* elem = GSetIterGetElem(&iter);
+      items[iItem]._val = GSetElemGetSortVal(elem);
+      items[iItem]._pos = iItem;
+      items[iItem]._adn = GSetElemData(elem);
+      ++iItem;
+    } while (GSetIterStep(&iter));
+    // Move the 'nb' best adns at the end of the array and sort them
+    long nbBest = MIN(nb, nbAdn);
+    if (nbBest < nbAdn)
+      GASelectNth(items, nbAdn, nbAdn - nbBest);
+    qsort(items + nbAdn - nbBest, nbBest, sizeof(GASelectItem), 
+      GACmpSelectItem);
+    // Put back the adns in the elements of the GSet in the new order
+    iter = GSetIterForwardCreateStatic(GAAdns(that));
+    iItem = 0;
+    do {
+      GSetElem* elem = GSetIterGetElem(&iter);
+      elem->_data = items[iItem]._adn;
+      GSetElemSetSortVal(elem, items[iItem]._val);
+      ++iItem;
+    } while (GSetIterStep(&iter));
+  }
+  GAUpdateRanks(that);
+}
+
+// Comparison function of GASelectItem for qsort, by value and then by
+// position to get the same order as the stable GSetSort
+int GACmpSelectItem(const void* const a, const void* const b) {
+  const GASelectItem* itemA = (const GASelectItem*)a;
+  const GASelectItem* itemB = (const GASelectItem*)b;
+  if (itemA->_val < itemB->_val)
+    return -1;
+  if (itemA->_val > itemB->_val)
+    return 1;
+  return (itemA->_pos > itemB->_pos) - (itemA->_pos < itemB->_pos);
+}
+
+// Partition the 'nb' GASelectItem 'items' such as the 'nth' one is 
+// the one it would be if they were sorted, the ones before it are 
+// lower and the ones after it are greater
+void GASelectNth(GASelectItem* const items, const long nb, 
+  const long nth) {
+  long first = 0;
+  long last = nb - 1;
+  while (first < last) {
+    // Use the median of the first, middle and last items as pivot,
+    // and move it at the end of the range
+    long mid = first + (last - first) / 2;
+    if (GACmpSelectItem(items + mid, items + first) < 0) {
+      GASelectItem tmp = items[mid];
+      items[mid] = items[first];
+      items[first] = tmp;
+    }
+    if (GACmpSelectItem(items + last, items + first) < 0) {
+      GASelectItem tmp = items[last];
+      items[last] = items[first];
+      items[first] = tmp;
+    }
+    if (GACmpSelectItem(items + mid, items + last) < 0) {
+      GASelectItem tmp = items[mid];
+      items[mid] = items[last];
+      items[last] = tmp;
+    }
+    // Partition the range around the pivot
+    long iPivot = first;
+    for (long iItem = first; iItem < last; ++iItem) {
+      if (GACmpSelectItem(items + iItem, items + last) < 0) {
+        GASelectItem tmp = items[iItem];
+        items[iItem] = items[iPivot];
+        items[iPivot] = tmp;
+        ++iPivot;
+      }
+    }
+    GASelectItem tmp = items[last];
+    items[last] = items[iPivot];
+    items[iPivot] = tmp;
+    // Continue in the side containing the 'nth' item
+    if (iPivot == nth)
+      return;
+    else if (iPivot < nth)
+      first = iPivot + 1;
+    else
+      last = iPivot - 1;
+  }
+}
+
+// Set the seed of the random generators of the GenAlg 'that' to 
+// 'seed' and reset its generator
+void GASetSeed(GenAlg* const that, const unsigned long seed) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  that->_seed = seed;
+  that->_rng = GARngCreateStatic(seed, 0);
+}
+
+// Evaluate the new GenAlgAdn of the GenAlg 'that' with the function
+// 'fun' and the user data 'data', using 'nbThread' threads
+// (including the calling thread)
+// The values are set with GASetAdnValue once all the evaluations are
+// done, 'fun' must be thread safe if 'nbThread' is greater than 1
+void GAEvaluate(GenAlg* const that, const GAEvalFun fun, 
+  void* const data, const int nbThread) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (fun == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'fun' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (nbThread < 1) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'nbThread' is invalid (%d>=1)", 
+      nbThread);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // Gather the adns needing an evaluation
+  int nbAdn = GAGetNbAdns(that);
+  GAEvalJob job;
+  job._adns = PBErrMalloc(GenAlgErr, sizeof(GenAlgAdn*) * nbAdn);
+  job._vals = PBErrMalloc(GenAlgErr, sizeof(float) * nbAdn);
+  job._fun = fun;
+  job._data = data;
+  long nbTask = 0;
+  for (int iAdn = 0; iAdn < nbAdn; ++iAdn) {
+    GenAlgAdn* adn = GAAdn(that, iAdn);
+    if (GAAdnIsNew(adn))
+      job._adns[nbTask++] = adn;
+  }
+  // Evaluate the adns, reusing the pool of the GenAlg if it has the 
+  // requested number of threads
+  if (nbThread > 1) {
+    GAPrepareThreadPool(that, nbThread);
+    GAThreadPoolRun(that->_pool, GAEvaluateTask, &job, nbTask);
+  } else {
+    for (long iTask = 0; iTask < nbTask; ++iTask)
+      GAEvaluateTask(&job, iTask, 0);
+  }
+  // Set the values in one pass from the calling thread
+  for (long iTask = 0; iTask < nbTask; ++iTask)
+    GASetAdnValue(that, job._adns[iTask], job._vals[iTask]);
+  // Free memory
+  free(job._adns);
+  free(job._vals);
+}
+
+// Evaluate the 'iTask'-th adn of the GAEvalJob 'data' from the 
+// thread 'iThread'
+void GAEvaluateTask(void* const data, const long iTask, 
+  const int iThread) {
+  GAEvalJob* job = (GAEvalJob*)data;
+  job->_vals[iTask] = 
+    job->_fun(job->_adns[iTask], job->_data, iThread);
+}
+
+// Evaluate the new GenAlgAdn of the GenAlg 'that' with one call to 
+// the function 'fun' with the user data 'data', the genes of all the
+// new adns being given as a GAGenesMatrix
+// The values are set with GASetAdnValue once all the evaluations are
+// done, in the same order as GAEvaluate
+void GAEvaluateMatrix(GenAlg* const that, const GAMatrixEvalFun fun, 
+  void* const data) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (fun == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'fun' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // Gather the adns needing an evaluation
+  int nbAdn = GAGetNbAdns(that);
+  GenAlgAdn** adns = PBErrMalloc(GenAlgErr, sizeof(GenAlgAdn*) * nbAdn);
+  long nbTask = 0;
+  for (int iAdn = 0; iAdn < nbAdn; ++iAdn) {
+    GenAlgAdn* adn = GAAdn(that, iAdn);
+    if (GAAdnIsNew(adn))
+      adns[nbTask++] = adn;
+  }
+  if (nbTask > 0) {
+    // Transpose the genes of the adns into the matrix
+    GAGenesMatrix* matrix = &(that->_matrix);
+    long lengthAdnF = GAGetLengthAdnFloat(that);
+    long lengthAdnI = GAGetLengthAdnInt(that);
+    GAGenesMatrixPrepare(matrix, nbTask, lengthAdnF, lengthAdnI);
+    long stride = matrix->_stride;
+    for (long iTask = 0; iTask < nbTask; ++iTask) {
+      if (lengthAdnF > 0) {
+        const float* adnF = GAAdnAdnF(adns[iTask])->_val;
+        for (long iGene = 0; iGene < lengthAdnF; ++iGene)
+          matrix->_adnF[iGene * stride + iTask] = adnF[iGene];
+      }
+      if (lengthAdnI > 0) {
+        const long* adnI = GAAdnAdnI(adns[iTask])->_val;
+        for (long iGene = 0; iGene < lengthAdnI; ++iGene)
+          matrix->_adnI[iGene * stride + iTask] = adnI[iGene];
+      }
+    }
+    // Evaluate the adns
+    fun(matrix, matrix->_scores, data);
+    // Set the values in one pass
+    for (long iTask = 0; iTask < nbTask; ++iTask)
+      GASetAdnValue(that, adns[iTask], matrix->_scores[iTask]);
+  }
+  // Free memory
+  free(adns);
+}
+
+// Evaluate the new GenAlgAdn of the GenAlg 'that', whose value is the
+// average of their values for 'nbCase' test cases, the value of one
+// test case being at most 'maxCase', using 'nbThread' threads 
+// (including the calling thread)
+// The test cases are given to the function 'fun' with the user data 
+// 'data' by chunks of 'sizeChunk', and the evaluation of an adn is
+// aborted as soon as it can't be better than the worst elite amongst
+// the adns already evaluated by any thread. Its value is then the 
+// upper bound of its actual value (cf GAAdnIsPartial)
+// The elites are the same as with a complete evaluation of the adns,
+// with several threads which of the other adns are aborted depends on
+// the order of the evaluations
+// The values are set with GASetAdnValue once all the evaluations are
+// done, in the same order as GAEvaluate, 'fun' must be thread safe if
+// 'nbThread' is greater than 1
+// Return the number of test cases evaluated
+long GAEvaluateRace(GenAlg* const that, const GARaceFun fun, 
+  void* const data, const long nbCase, const long sizeChunk, 
+  const float maxCase, const int nbThread) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (fun == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'fun' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (nbCase < 1) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'nbCase' is invalid (%ld>=1)", nbCase);
+    PBErrCatch(GenAlgErr);
+  }
+  if (sizeChunk < 1) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'sizeChunk' is invalid (%ld>=1)", 
+      sizeChunk);
+    PBErrCatch(GenAlgErr);
+  }
+  if (nbThread < 1) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'nbThread' is invalid (%d>=1)", 
+      nbThread);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // Gather the adns needing an evaluation, and the values of the 
+  // other ones amongst the best values
+  int nbAdn = GAGetNbAdns(that);
+  GARaceJob job;
+  job._adns = PBErrMalloc(GenAlgErr, sizeof(GenAlgAdn*) * nbAdn);
+  job._vals = PBErrMalloc(GenAlgErr, sizeof(float) * nbAdn);
+  job._flagPartial = PBErrMalloc(GenAlgErr, sizeof(bool) * nbAdn);
+  job._nbEvalCase = PBErrMalloc(GenAlgErr, sizeof(long) * nbAdn);
+  job._fun = fun;
+  job._data = data;
+  job._nbCase = nbCase;
+  job._sizeChunk = sizeChunk;
+  job._maxCase = maxCase;
+  pthread_mutex_init(&(job._mutex), NULL);
+  job._nbElite = GAGetNbElites(that);
+  job._best = PBErrMalloc(GenAlgErr, sizeof(float) * job._nbElite);
+  job._nbBest = 0;
+  long nbTask = 0;
+  for (int iAdn = 0; iAdn < nbAdn; ++iAdn) {
+    GenAlgAdn* adn = GAAdn(that, iAdn);
+    if (GAAdnIsNew(adn))
+      job._adns[nbTask++] = adn;
+    else
+      GARaceInsertBest(job._best, &(job._nbBest), job._nbElite, 
+        GAAdnGetVal(adn));
+  }
+  // Evaluate the adns, reusing the pool of the GenAlg if it has the 
+  // requested number of threads
+  if (nbThread > 1) {
+    GAPrepareThreadPool(that, nbThread);
+    GAThreadPoolRun(that->_pool, GAEvaluateRaceTask, &job, nbTask);
+  } else {
+    for (long iTask = 0; iTask < nbTask; ++iTask)
+      GAEvaluateRaceTask(&job, iTask, 0);
+  }
+  // Set the values in one pass from the calling thread
+  long nbEvalCase = 0;
+  for (long iTask = 0; iTask < nbTask; ++iTask) {
+    GASetAdnValue(that, job._adns[iTask], job._vals[iTask]);
+    job._adns[iTask]->_flagPartialVal = job._flagPartial[iTask];
+    nbEvalCase += job._nbEvalCase[iTask];
+  }
+  // Free memory
+  pthread_mutex_destroy(&(job._mutex));
+  free(job._best);
+  free(job._adns);
+  free(job._vals);
+  free(job._flagPartial);
+  free(job._nbEvalCase);
+  // Return the number of test cases evaluated
+  return nbEvalCase;
+}
+
+// Evaluate the 'iTask'-th adn of the GARaceJob 'data' from the 
+// thread 'iThread'
+void GAEvaluateRaceTask(void* const data, const long iTask, 
+  const int iThread) {
+  GARaceJob* job = (GARaceJob*)data;
+  long nbCase = job->_nbCase;
+  float sum = 0.0;
+  long iCase = 0;
+  bool flagPartial = false;
+  float val = 0.0;
+  // Evaluate the adn chunk by chunk
+  while (iCase < nbCase) {
+    long nb = MIN(job->_sizeChunk, nbCase - iCase);
+    sum += job->_fun(job->_adns[iTask], iCase, nb, job->_data, iThread);
+    iCase += nb;
+    if (iCase == nbCase)
+      break;
+    // Abort if even with the best values for the remaining cases the
+    // adn wouldn't be an elite
+    pthread_mutex_lock(&(job->_mutex));
+    bool flagFull = (job->_nbBest == job->_nbElite);
+    float worst = (flagFull ? job->_best[job->_nbElite - 1] : 0.0);
+    pthread_mutex_unlock(&(job->_mutex));
+    if (flagFull) {
+      float bound = 
+        (sum + job->_maxCase * (float)(nbCase - iCase)) / (float)nbCase;
+      if (bound < worst) {
+        val = bound;
+        flagPartial = true;
+        break;
+      }
+    }
+  }
+  // Share the value of a complete evaluation with the other threads
+  if (flagPartial == false) {
+    val = sum / (float)nbCase;
+    pthread_mutex_lock(&(job->_mutex));
+    GARaceInsertBest(job->_best, &(job->_nbBest), job->_nbElite, val);
+    pthread_mutex_unlock(&(job->_mutex));
+  }
+  job->_vals[iTask] = val;
+  job->_flagPartial[iTask] = flagPartial;
+  job->_nbEvalCase[iTask] = iCase;
+}
+
+// Insert the value 'val' in the 'nbBest' values 'best' sorted from 
+// the best, keeping at most 'nbMax' values
+void GARaceInsertBest(float* const best, int* const nbBest, 
+  const int nbMax, const float val) {
+  // If the value is not amongst the best ones, nothing to do
+  if (*nbBest == nbMax && val <= best[nbMax - 1])
+    return;
+  // Shift the worse values and insert the new one
+  int pos = (*nbBest < nbMax ? *nbBest : nbMax - 1);
+  while (pos > 0 && best[pos - 1] < val) {
+    best[pos] = best[pos - 1];
+    --pos;
+  }
+  best[pos] = val;
+  if (*nbBest < nbMax)
+    ++(*nbBest);
+}
+
+// Ensure the GAGenesMatrix 'that' can hold 'nb' candidates with genes
+// of length 'lengthAdnF' and 'lengthAdnI', and null its columns
+void GAGenesMatrixPrepare(GAGenesMatrix* const that, const long nb, 
+  const long lengthAdnF, const long lengthAdnI) {
+  // Round up the number of columns, a row of floats is then a 
+  // multiple of the alignment and so is a row of longs
+  long align = GENALG_STORE_ALIGN / sizeof(float);
+  long stride = ((nb + align - 1) / align) * align;
+  // Reallocate the matrices if they are too small, the genes' lengths
+  // of a GenAlg don't change
+  if (that->_nbMaxStride < stride || 
+    that->_lengthAdnF != lengthAdnF || 
+    that->_lengthAdnI != lengthAdnI) {
+    free(that->_adnF);
+    free(that->_adnI);
+    free(that->_scores);
+    that->_adnF = NULL;
+    that->_adnI = NULL;
+    if (lengthAdnF > 0)
+      that->_adnF = aligned_alloc(GENALG_STORE_ALIGN, 
+        sizeof(float) * lengthAdnF * stride);
+    if (lengthAdnI > 0)
+      that->_adnI = aligned_alloc(GENALG_STORE_ALIGN, 
+        sizeof(long) * lengthAdnI * stride);
+    that->_scores = aligned_alloc(GENALG_STORE_ALIGN, 
+      sizeof(float) * stride);
+    if ((lengthAdnF > 0 && that->_adnF == NULL) || 
+      (lengthAdnI > 0 && that->_adnI == NULL) ||
+      that->_scores == NULL) {
+      GenAlgErr->_type = PBErrTypeNullPointer;
+      sprintf(GenAlgErr->_msg, "aligned_alloc failed (%ld columns)", 
+        stride);
+      PBErrCatch(GenAlgErr);
+    }
+    that->_nbMaxStride = stride;
+    that->_lengthAdnF = lengthAdnF;
+    that->_lengthAdnI = lengthAdnI;
+  }
+  // Set the properties and null the matrices, the extra columns must 
+  // be valid genes for the evaluation function
+  that->_nb = nb;
+  that->_stride = stride;
+  if (lengthAdnF > 0)
+    memset(that->_adnF, 0, sizeof(float) * lengthAdnF * stride);
+  if (lengthAdnI > 0)
+    memset(that->_adnI, 0, sizeof(long) * lengthAdnI * stride);
+  memset(that->_scores, 0, sizeof(float) * stride);
+}
+
+// Ensure the pool of threads of the GenAlg 'that' exists and has 
+// 'nbThread' threads
+void GAPrepareThreadPool(GenAlg* const that, const int nbThread) {
+  // If the current pool doesn't have the requested number of threads
+  // free it
+  if (that->_pool != NULL && 
+    GAThreadPoolGetNbThread(that->_pool) != nbThread)
+    GAThreadPoolFree(&(that->_pool));
+  // Create the pool if necessary
+  if (that->_pool == NULL)
+    that->_pool = GAThreadPoolCreate(nbThread);
+}
+
+// Ensure the GenAlg 'that' has the scratch memory of 'nbThread' 
+// threads, sized for its current type
+void GAPrepareScratch(GenAlg* const that, const int nbThread) {
+  // Add the missing threads
+  if (that->_nbScratch < nbThread) {
+    that->_scratch = realloc(that->_scratch, 
+      sizeof(GAScratch) * nbThread);
+    if (that->_scratch == NULL) {
+      GenAlgErr->_type = PBErrTypeNullPointer;
+      sprintf(GenAlgErr->_msg, "realloc failed");
+      PBErrCatch(GenAlgErr);
+    }
+    for (int iThread = that->_nbScratch; iThread < nbThread; ++iThread)
+      that->_scratch[iThread] = (GAScratch){0};
+    that->_nbScratch = nbThread;
+  }
+  // Get the size of the flags of used values
+  long nbIsUsed = 0;
+  if (GAGetType(that) == genAlgTypeNeuraNet)
+    nbIsUsed = that->_NNdata._nbIn + that->_NNdata._nbHid;
+  // Enlarge the memory of the threads if necessary
+  for (int iThread = 0; iThread < nbThread; ++iThread) {
+    GAScratch* scratch = that->_scratch + iThread;
+    if (scratch->_nbIsUsed < nbIsUsed) {
+      free(scratch->_isUsed);
+      scratch->_isUsed = PBErrMalloc(GenAlgErr, sizeof(char) * nbIsUsed);
+      scratch->_nbIsUsed = nbIsUsed;
+    }
+  }
+}
+
+// Set the number of threads used by GAStep of the GenAlg 'that' 
+// to 'nb'
+void GASetNbThread(GenAlg* const that, const int nb) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (nb < 1) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'nb' is invalid (%d>=1)", nb);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  that->_nbThread = nb;
+}
+
 // Init the GenAlg 'that'
 // Must be called after the bounds have been set
-// The random generator must have been initialised before calling this
-// function
+// The genes are initialised with the random generator of the GenAlg,
+// use GASetSeed before calling this function for a reproducible run
 void GAInit(GenAlg* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
@@ -509,8 +1652,12 @@ void GAInit(GenAlg* const that) {
     GAAdnInit(adn, that);
   } while (GSetIterStep(&iter));
   GAAdnCopy(that->_bestAdn, GAAdn(that, 0));
+  // The genes have changed but not the ids
+  GAResetEliteDiversity(that);
+  GAResetCheckpoint(that);
   that->_flagKTEvent = false;
   that->_curEpoch = 0;
+  GAAskTellReset(&(that->_askTell));
   // If the user requested to save the history
   if (GAGetFlagHistory(that) == true) {
     // Update the history
@@ -528,6 +1675,18 @@ void GAInit(GenAlg* const that) {
   }
 }
 
+// Return the lowest rank of the adns reset by a KT event of the 
+// GenAlg 'that': the elites more diverse than the worst elite are 
+// kept, the best adn is always kept
+int GAKTEventGetRankMin(const GenAlg* const that) {
+  int iAdnMin = 1;
+  while (iAdnMin < GAGetNbElites(that) - 1 &&
+    fabs(GAAdn(that, iAdnMin)->_val - GAAdn(that, GAGetNbElites(that) - 1)->_val) > GAGetDiversityThreshold(that)) {
+    ++iAdnMin;
+  }
+  return iAdnMin;
+}
+
 // Reset the GenAlg 'that'
 // Randomize all the gene except those of the best adn
 void GAKTEvent(GenAlg* const that) {
@@ -539,11 +1698,7 @@ void GAKTEvent(GenAlg* const that) {
   }
 #endif
 
-  int iAdnMin = 1;
-  while (iAdnMin < GAGetNbElites(that) - 1 &&
-    fabs(GAAdn(that, iAdnMin)->_val - GAAdn(that, GAGetNbElites(that) - 1)->_val) > GAGetDiversityThreshold(that)) {
-    ++iAdnMin;
-  }
+  int iAdnMin = GAKTEventGetRankMin(that);
 
   for (int iAdn = GAGetNbAdns(that) - 1; iAdn >= iAdnMin ; --iAdn) {
     GenAlgAdn* adn = GAAdn(that, iAdn);
@@ -640,9 +1795,20 @@ void GAStep(GenAlg* const that) {
 #endif
   // Reset the flag about KTEvent
   that->_flagKTEvent = false;
+  // Record the values of the new adns in the fitness cache, except 
+  // the upper bounds of the aborted evaluations
+  if (that->_fitnessCache._nbMax > 0) {
+    GSetIterForward iter = GSetIterForwardCreateStatic(GAAdns(that));
+    do {
+      GenAlgAdn* adn = GSetIterGet(&iter);
+      if (GAAdnIsNew(adn) && GAAdnIsPartial(adn) == false)
+        GAFitnessCachePut(&(that->_fitnessCache), adn);
+    } while (GSetIterStep(&iter));
+  }
   // Selection, Reproduction, Mutation
-  // Ensure the set of adns is sorted
-  GSetSort(GAAdns(that));
+  // Ensure the elites are sorted, the other adns are replaced by the
+  // children so their order doesn't matter
+  GASelectBest(that, GAGetNbElites(that));
   // Variable to memorize if there has been improvement
   bool flagImprov = false;
   // Update the best adn if necessary
@@ -664,7 +1830,13 @@ void GAStep(GenAlg* const that) {
         GAAdn(that, 0)->_id = (that->_nextId)++;
       }
       // Check for the diversity level
-      float diversity = GAGetDiversity(that);
+      float diversity = 0.0;
+      if (GAGetFlagEliteDiversity(that) == true) {
+        GAUpdateEliteDiversity(that);
+        diversity = GAGetEliteDiversityAvg(that);
+      } else {
+        diversity = GAGetDiversity(that);
+      }
       if (diversity < GAGetDiversityThreshold(that)) {
         GAKTEvent(that);
       }
@@ -693,20 +1865,34 @@ void GAStep(GenAlg* const that) {
     GAAdn(that, iAdn)->_idParents[0] = GAAdnGetId(GAAdn(that, iAdn));
     GAAdn(that, iAdn)->_idParents[1] = GAAdnGetId(GAAdn(that, iAdn));
   }
-  // For each adn which is not an elite
-  for (int iAdn = GAGetNbElites(that); iAdn < GAGetNbAdns(that); 
-    ++iAdn) {
-    // Declare a variable to memorize the parents
-    int parents[2];
-    // Select two parents for this adn
-    GASelectParents(that, parents);
-    // Set the genes of the adn as a 50/50 mix of parents' genes
-    GAReproduction(that, parents, iAdn);
-    // Mute the genes of the adn
-    GAMute(that, parents, iAdn);
+  // Create the children (adns which are not elite), in parallel if 
+  // the GenAlg uses several threads
+  long nbChild = GAGetNbAdns(that) - GAGetNbElites(that);
+  GAPrepareScratch(that, GAGetNbThread(that));
+  if (GAGetNbThread(that) > 1) {
+    GAPrepareThreadPool(that, GAGetNbThread(that));
+    GAThreadPoolRun(that->_pool, GAStepChild, that, nbChild);
+  } else {
+    for (long iChild = 0; iChild < nbChild; ++iChild)
+      GAStepChild(that, iChild, 0);
+  }
+  that->_nextId += (unsigned long)nbChild;
+  // Look up the children in the fitness cache
+  for (long iChild = 0; iChild < nbChild; ++iChild) {
+    GenAlgAdn* child = GAAdn(that, GAGetNbElites(that) + (int)iChild);
+    child->_flagCachedVal = false;
+    child->_flagPartialVal = false;
+    float val = 0.0;
+    if (that->_fitnessCache._nbMax > 0 && 
+      GAFitnessCacheGet(&(that->_fitnessCache), child, &val)) {
+      GASetAdnValue(that, child, val);
+      child->_flagCachedVal = true;
+    }
   }
   // Increment the number of epochs
   ++(that->_curEpoch);
+  // The adns given by GAAsk are obsolete
+  GAAskTellReset(&(that->_askTell));
   // If the user requested to save the history
   if (GAGetFlagHistory(that) == true) {
     // Update the history
@@ -717,9 +1903,417 @@ void GAStep(GenAlg* const that) {
   }
 }
 
+// Select the parents, reproduce and mute the 'iChild'-th child of the
+// GenAlg 'data' (the adn at rank nbElites + 'iChild') during GAStep
+// Each child uses its own random generator stream, so the result 
+// doesn't depend on the thread 'iThread' executing it
+void GAStepChild(void* const data, const long iChild, 
+  const int iThread) {
+  GenAlg* that = (GenAlg*)data;
+  int iAdn = GAGetNbElites(that) + (int)iChild;
+  // Get the stream of this child for the current epoch, the stream 0
+  // is reserved for the main generator of the GenAlg
+  GARng rng = GARngCreateStatic(GAGetSeed(that), 
+    ((unsigned long)(GAGetCurEpoch(that) + 1) << 32) | 
+    (unsigned long)iAdn);
+  // Declare a variable to memorize the parents
+  int parents[2];
+  // Select two parents for this adn
+  GASelectParents(that, parents, &rng);
+  // Set the genes of the adn as a 50/50 mix of parents' genes
+  GAReproduction(that, parents, iAdn, &rng);
+  // Mute the genes of the adn
+  GAMute(that, parents, iAdn, &rng, iThread);
+}
+
+// Set the steady state mode of the GenAlg 'that' to 'flag'
+// In steady state mode, GAStep is not used: the children are created
+// one by one by GAGetSteadyChild and each one replaces the worst adn
+// of the population as soon as its value is given by 
+// GASetSteadyChildValue, if it's better. The adns of the population 
+// must have been evaluated when the mode is turned on, and all the 
+// children must have been given back when it's turned off
+// An epoch ends every (nbAdns - nbElites) children, then the ages of 
+// the elites are updated and the KT event is checked as in GAStep. 
+// The adns killed by a KT event get the lowest value, so they are 
+// the first ones replaced. The number of adns doesn't change in 
+// steady state mode
+void GASetFlagSteadyState(GenAlg* const that, const bool flag) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  if (flag == true && that->_steady == NULL) {
+    that->_steady = PBErrMalloc(GenAlgErr, sizeof(GASteadyState));
+    pthread_mutex_init(&(that->_steady->_mutex), NULL);
+    that->_steady->_spares = GSetCreateStatic();
+    that->_steady->_nbAsked = 0;
+    that->_steady->_nbTold = 0;
+    that->_steady->_nbDead = 0;
+    that->_steady->_flagImprov = false;
+    // Rank the evaluated population and memorize its best adn
+    GSetSort(GAAdns(that));
+    GAUpdateRanks(that);
+    if (that->_curEpoch <= 1 || 
+      GAAdnGetVal(GAAdn(that, 0)) > GAAdnGetVal(GABestAdn(that))) {
+      GAAdnCopy(that->_bestAdn, GAAdn(that, 0));
+      that->_bestAdn->_age = that->_curEpoch + 1;
+    }
+  } else if (flag == false && that->_steady != NULL) {
+    while (GSetNbElem(&(that->_steady->_spares)) > 0) {
+      GenAlgAdn* child = GSetPop(&(that->_steady->_spares));
+      GenAlgAdnFree(&child);
+    }
+    pthread_mutex_destroy(&(that->_steady->_mutex));
+    free(that->_steady);
+    that->_steady = NULL;
+  }
+}
+
+// Create a new child from the elites of the GenAlg 'that' in steady 
+// state mode and return it
+// The child is not in the population, it must be evaluated and given 
+// back with GASetSteadyChildValue
+// Can be called from several threads
+GenAlgAdn* GAGetSteadyChild(GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (that->_steady == NULL) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'that' is not in steady state mode");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  GASteadyState* steady = that->_steady;
+  pthread_mutex_lock(&(steady->_mutex));
+  // Reuse a child given back or create a new one
+  GenAlgAdn* child = NULL;
+  if (GSetNbElem(&(steady->_spares)) > 0)
+    child = GSetPop(&(steady->_spares));
+  else
+    child = GenAlgAdnCreate(0, GAGetLengthAdnFloat(that), 
+      GAGetLengthAdnInt(that));
+  // The genetic operators work on ranks, so the child temporarily 
+  // takes the place of a non elite adn in the rank index. The ranks 
+  // are cycled so the probabilities of mutation are the same as 
+  // during an epoch of GAStep
+  int nbChild = GAGetNbAdns(that) - GAGetNbElites(that);
+  int iAdn = GAGetNbElites(that) + (int)(steady->_nbAsked % nbChild);
+  ++(steady->_nbAsked);
+  GSetElem* elem = that->_ranks[iAdn];
+  void* adn = elem->_data;
+  elem->_data = child;
+  int parents[2];
+  GASelectParents(that, parents, &(that->_rng));
+  GAReproduction(that, parents, iAdn, &(that->_rng));
+  GAPrepareScratch(that, 1);
+  GAMute(that, parents, iAdn, &(that->_rng), 0);
+  elem->_data = adn;
+  // Set the properties of the new child
+  child->_id = (that->_nextId)++;
+  child->_age = 1;
+  child->_rank = -1;
+  child->_flagCachedVal = false;
+  child->_flagPartialVal = false;
+  pthread_mutex_unlock(&(steady->_mutex));
+  return child;
+}
+
+// Give back the child 'child' created by GAGetSteadyChild of the 
+// GenAlg 'that' in steady state mode with its value 'val'
+// If 'val' is better than the value of the worst adn of the 
+// population, the child replaces it and is inserted at its rank
+// 'child' must not be used anymore after this call
+// Can be called from several threads
+void GASetSteadyChildValue(GenAlg* const that, GenAlgAdn* const child,
+  const float val) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (child == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'child' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (that->_steady == NULL) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'that' is not in steady state mode");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  GASteadyState* steady = that->_steady;
+  pthread_mutex_lock(&(steady->_mutex));
+  GenAlgAdn* worst = GAAdn(that, GAGetNbAdns(that) - 1);
+  if (val > GAAdnGetVal(worst)) {
+    if (GAAdnGetVal(worst) <= -FLT_MAX)
+      --(steady->_nbDead);
+    // Copy the child into the worst adn, which may be a view on the 
+    // store of the GenAlg
+    if (child->_adnF != NULL) {
+      VecCopy(worst->_adnF, child->_adnF);
+      VecCopy(worst->_deltaAdnF, child->_deltaAdnF);
+    }
+    if (child->_adnI != NULL)
+      VecCopy(worst->_adnI, child->_adnI);
+    worst->_id = child->_id;
+    worst->_idParents[0] = child->_idParents[0];
+    worst->_idParents[1] = child->_idParents[1];
+    worst->_age = 1;
+    worst->_val = val;
+    worst->_flagCachedVal = false;
+    worst->_flagPartialVal = false;
+    // Move it from the head of the set to its rank
+    GSetPop(GAAdns(that));
+    GSetAddSort(GAAdns(that), worst, val);
+    GAUpdateRanks(that);
+    // Update the best adn if necessary
+    if (val > GAAdnGetVal(GABestAdn(that))) {
+      GAAdnCopy(that->_bestAdn, worst);
+      that->_bestAdn->_age = that->_curEpoch + 1;
+      steady->_flagImprov = true;
+    }
+    // Update the history
+    if (GAGetFlagHistory(that) == true)
+      GAHistoryRecordBirth(&(that->_history), worst, 
+        GAGetCurEpoch(that));
+  }
+  GSetPush(&(steady->_spares), child);
+  // End the epoch if a generation of children has been evaluated
+  ++(steady->_nbTold);
+  if (steady->_nbTold >= GAGetNbAdns(that) - GAGetNbElites(that)) {
+    steady->_nbTold = 0;
+    GASteadyStateEndEpoch(that);
+  }
+  pthread_mutex_unlock(&(steady->_mutex));
+}
+
+// Return a new GABatch of at most 'maxBatch' new adns of the current 
+// epoch of the GenAlg 'that' which haven't been given yet
+// The batch is empty if all the new adns of the current epoch have 
+// been given and some of them are still waiting for their value
+// Several batches can be evaluated at the same time, by several 
+// threads, the ranks of the adns are not used
+GABatch* GAAsk(GenAlg* const that, const long maxBatch) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (maxBatch < 1) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'maxBatch' is invalid (%ld>=1)", 
+      maxBatch);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  GAAskTell* askTell = &(that->_askTell);
+  pthread_mutex_lock(&(askTell->_mutex));
+  if (askTell->_flagGathered == false)
+    GAAskGather(that);
+  // Allocate memory for the batch
+  long nb = MIN(maxBatch, askTell->_nbToAsk);
+  long lengthF = GAGetLengthAdnFloat(that);
+  long lengthI = GAGetLengthAdnInt(that);
+  GABatch* batch = PBErrMalloc(GenAlgErr, sizeof(GABatch));
+  batch->_nb = nb;
+  batch->_lengthAdnF = lengthF;
+  batch->_lengthAdnI = lengthI;
+  batch->_generation = askTell->_generation;
+  batch->_ids = PBErrMalloc(GenAlgErr, sizeof(unsigned long) * nb);
+  batch->_adns = PBErrMalloc(GenAlgErr, sizeof(GenAlgAdn*) * nb);
+  batch->_adnF = PBErrMalloc(GenAlgErr, sizeof(float) * nb * lengthF);
+  batch->_adnI = PBErrMalloc(GenAlgErr, sizeof(long) * nb * lengthI);
+  // Copy the genes of the adns in the contiguous buffers
+  for (long iCandidate = 0; iCandidate < nb; ++iCandidate) {
+    GenAlgAdn* adn = askTell->_toAsk[--(askTell->_nbToAsk)];
+    batch->_adns[iCandidate] = adn;
+    batch->_ids[iCandidate] = GAAdnGetId(adn);
+    if (lengthF > 0)
+      memcpy(batch->_adnF + iCandidate * lengthF, adn->_adnF->_val, 
+        sizeof(float) * lengthF);
+    if (lengthI > 0)
+      memcpy(batch->_adnI + iCandidate * lengthI, adn->_adnI->_val, 
+        sizeof(long) * lengthI);
+  }
+  pthread_mutex_unlock(&(askTell->_mutex));
+  return batch;
+}
+
+// Give the values 'scores' of the candidates of the GABatch 'batch' to
+// the GenAlg 'that', 'scores' is in the order of the candidates of 
+// the batch, and free the batch
+// When all the new adns of the current epoch have their value, GAStep
+// is called and the new adns of the next epoch can be asked
+// The scores of a batch given before the last call to GAStep or 
+// GAInit are ignored
+// Return true if GAStep has been called, else false
+bool GATell(GenAlg* const that, GABatch** const batch, 
+  const float* const scores) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (batch == NULL || *batch == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'batch' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (scores == NULL && (*batch)->_nb > 0) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'scores' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  GAAskTell* askTell = &(that->_askTell);
+  bool ret = false;
+  pthread_mutex_lock(&(askTell->_mutex));
+  if ((*batch)->_generation == askTell->_generation && 
+    askTell->_flagGathered == true) {
+    // Set the values of the candidates
+    for (long iCandidate = 0; iCandidate < (*batch)->_nb; 
+      ++iCandidate) {
+      GASetAdnValue(that, (*batch)->_adns[iCandidate], 
+        scores[iCandidate]);
+    }
+    askTell->_nbToTell -= (*batch)->_nb;
+    // If all the new adns have their value, step to the next epoch
+    if (askTell->_nbToTell == 0 && askTell->_nbToAsk == 0) {
+      GAStep(that);
+      ret = true;
+    }
+  }
+  pthread_mutex_unlock(&(askTell->_mutex));
+  GABatchFree(batch);
+  return ret;
+}
+
+// Gather the new adns of the current epoch of the GenAlg 'that' for 
+// GAAsk, stepping the epochs without new adns
+void GAAskGather(GenAlg* const that) {
+  GAAskTell* askTell = &(that->_askTell);
+  do {
+    // Ensure the array is large enough
+    if (askTell->_nbMaxToAsk < GAGetNbAdns(that)) {
+      askTell->_nbMaxToAsk = MAX(GAGetNbAdns(that), GAGetNbMaxAdn(that));
+      free(askTell->_toAsk);
+      askTell->_toAsk = PBErrMalloc(GenAlgErr, 
+        sizeof(GenAlgAdn*) * askTell->_nbMaxToAsk);
+    }
+    // Gather the new adns, from the worst rank so the best ones are
+    // asked first
+    askTell->_nbToAsk = 0;
+    for (int iAdn = GAGetNbAdns(that); iAdn--;) {
+      GenAlgAdn* adn = GAAdn(that, iAdn);
+      if (GAAdnIsNew(adn))
+        askTell->_toAsk[(askTell->_nbToAsk)++] = adn;
+    }
+    // If all the values have been found in the fitness cache, step 
+    // directly to the next epoch
+    if (askTell->_nbToAsk == 0)
+      GAStep(that);
+  } while (askTell->_nbToAsk == 0);
+  askTell->_nbToTell = askTell->_nbToAsk;
+  askTell->_flagGathered = true;
+}
+
+// Forget the adns gathered by the ask/tell state 'that', the batches 
+// given until now become obsolete
+void GAAskTellReset(GAAskTell* const that) {
+  that->_nbToAsk = 0;
+  that->_nbToTell = 0;
+  that->_flagGathered = false;
+  ++(that->_generation);
+}
+
+// Free the memory used by the GABatch 'that'
+void GABatchFree(GABatch** const that) {
+  // Check the argument
+  if (that == NULL || *that == NULL) return;
+  // Free memory
+  free((*that)->_ids);
+  free((*that)->_adns);
+  free((*that)->_adnF);
+  free((*that)->_adnI);
+  free(*that);
+  *that = NULL;
+}
+
+// End the current epoch of the GenAlg 'that' in steady state mode: 
+// update the ages of the elites and check the KT event
+void GASteadyStateEndEpoch(GenAlg* const that) {
+  GASteadyState* steady = that->_steady;
+  ++(that->_curEpoch);
+  // For each adn which is an elite
+  for (int iAdn = 0; iAdn < GAGetNbElites(that); ++iAdn) {
+    // Increment age
+    ++(GAAdn(that, iAdn)->_age);
+    // Update the parents
+    GAAdn(that, iAdn)->_idParents[0] = GAAdnGetId(GAAdn(that, iAdn));
+    GAAdn(that, iAdn)->_idParents[1] = GAAdnGetId(GAAdn(that, iAdn));
+  }
+  // If there has been no improvement and the previous KT event is 
+  // over
+  if (steady->_flagImprov == false && steady->_nbDead == 0) {
+    // If the boss is too old, kill the boss !
+    if (GAAdnGetAge(GAAdn(that, 0)) > GAGetMaxAge(that)) {
+      GASteadyStateKill(that, 0);
+    } else {
+      // Check for the diversity level
+      float diversity = 0.0;
+      if (GAGetFlagEliteDiversity(that) == true) {
+        GAUpdateEliteDiversity(that);
+        diversity = GAGetEliteDiversityAvg(that);
+      } else {
+        diversity = GAGetDiversity(that);
+      }
+      if (diversity < GAGetDiversityThreshold(that)) {
+        int iAdnMin = GAKTEventGetRankMin(that);
+        for (int iAdn = GAGetNbAdns(that) - 1; iAdn >= iAdnMin; --iAdn)
+          GASteadyStateKill(that, iAdn);
+        if (iAdnMin == 1)
+          that->_nbKTEvent += 1;
+      }
+    }
+    // Move the killed adns to the worst ranks
+    GSetSort(GAAdns(that));
+    GAUpdateRanks(that);
+  }
+  steady->_flagImprov = false;
+  // Refresh the TextOMeter if necessary
+  if (that->_flagTextOMeter) {
+    GAUpdateTextOMeter(that);
+  }
+}
+
+// Kill the adn at rank 'iRank' of the GenAlg 'that' in steady state 
+// mode: its genes are reinitialised and it gets the lowest value
+// The ranks must be updated after
+void GASteadyStateKill(GenAlg* const that, const int iRank) {
+  GenAlgAdn* adn = GAAdn(that, iRank);
+  GAAdnInit(adn, that);
+  adn->_age = 0;
+  adn->_id = (that->_nextId)++;
+  GASetAdnValue(that, adn, -FLT_MAX);
+  ++(that->_steady->_nbDead);
+}
+
 // Select the rank of two parents for the SRM algorithm
 // Return the ranks in 'parents', with parents[0] <= parents[1]
-void GASelectParents(const GenAlg* const that, int* const parents) {
+void GASelectParents(const GenAlg* const that, int* const parents,
+  GARng* const rng) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
@@ -740,7 +2334,8 @@ void GASelectParents(const GenAlg* const that, int* const parents) {
       // adn, but it's not a problem so leave it and let's call that 
       // the Hawking radiation of this function in memory of this great 
       // man.
-      p[i] = (int)floor(rnd() * (float)GAGetNbElites(that)) - 1;
+      p[i] = 
+        (int)floor(GARngUnif(rng) * (float)GAGetNbElites(that)) - 1;
   } while (p[0] == p[1]);
   // Memorize the sorted parents' rank
   if (p[0] < p[1]) {
@@ -759,7 +2354,7 @@ void GASelectParents(const GenAlg* const that, int* const parents) {
 // Set the genes of the adn at rank 'iChild' as a 50/50 mix of the 
 // genes of adns at ranks 'parents[0]' and 'parents[1]'
 void GAReproduction(GenAlg* const that, 
-  const int* const parents, const int iChild) {
+  const int* const parents, const int iChild, GARng* const rng) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
@@ -780,20 +2375,24 @@ void GAReproduction(GenAlg* const that,
 #endif
   switch (GAGetType(that)) {
     case genAlgTypeNeuraNet:
-      GAReproductionNeuraNet(that, parents, iChild);
+      GAReproductionNeuraNet(that, parents, iChild, rng);
       break;
     case genAlgTypeNeuraNetConv:
-      GAReproductionNeuraNetConv(that, parents, iChild);
+      GAReproductionNeuraNetConv(that, parents, iChild, rng);
       break;
     case genAlgTypeMorpheus:
-      GAReproductionMorpheus(that, parents, iChild);
+      GAReproductionMorpheus(that, parents, iChild, rng);
       break;
     case genAlgTypeDefault:
     default:
-      GAReproductionDefault(that, parents, iChild);
+      GAReproductionDefault(that, parents, iChild, rng);
   }
-  // Update the parent id in the new child
+  // Set the id of the child from its rank, so it doesn't depend on 
+  // the order in which the children are created
   GenAlgAdn* child = GAAdn(that, iChild);
+  child->_id = that->_nextId + 
+    (unsigned long)(iChild - GAGetNbElites(that));
+  // Update the parent id in the new child
   child->_idParents[0] = GAAdnGetId(GAAdn(that, parents[0]));
   child->_idParents[1] = GAAdnGetId(GAAdn(that, parents[1]));
 }
@@ -803,7 +2402,7 @@ void GAReproduction(GenAlg* const that,
 // This version is optimised to calculate the parameters of a NeuraNet
 // by inheriting whole bases and links from parents
 void GAReproductionNeuraNet(GenAlg* const that, 
-  const int* const parents, const int iChild) {
+  const int* const parents, const int iChild, GARng* const rng) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
@@ -830,7 +2429,7 @@ void GAReproductionNeuraNet(GenAlg* const that,
   for (long iGene = 0; iGene < GAGetLengthAdnFloat(that); iGene += 3) {
     // Get the gene from one parent or the other with equal 
     // probabililty
-    if (rnd() < 0.5) {
+    if (GARngUnif(rng) < 0.5) {
       for (long jGene = 3; jGene--;) {
         VecSet(child->_adnF, iGene + jGene, 
           VecGet(parentA->_adnF, iGene + jGene));
@@ -849,7 +2448,7 @@ void GAReproductionNeuraNet(GenAlg* const that,
   // For each gene of the adn for int value
   for (long iGene = 0; iGene < GAGetLengthAdnInt(that); iGene += 3) {
     // Get the gene from one parent or the other with equal probabililty
-    if (rnd() < 0.5) {
+    if (GARngUnif(rng) < 0.5) {
       for (long jGene = 3; jGene--;)
         VecSet(child->_adnI, iGene + jGene, 
           VecGet(parentA->_adnI, iGene + jGene));
@@ -861,8 +2460,6 @@ void GAReproductionNeuraNet(GenAlg* const that,
   }
   // Reset the age of the child
   child->_age = 1;
-  // Set the id of the child
-  child->_id = (that->_nextId)++;
 }
 
 // Set the genes of the adn at rank 'iChild' as a 50/50 mix of the 
@@ -870,7 +2467,7 @@ void GAReproductionNeuraNet(GenAlg* const that,
 // This version is optimised to calculate the parameters of a NeuraNet
 // with convolution by inheriting whole bases from parents
 void GAReproductionNeuraNetConv(GenAlg* const that, 
-  const int* const parents, const int iChild) {
+  const int* const parents, const int iChild, GARng* const rng) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
@@ -899,7 +2496,7 @@ void GAReproductionNeuraNetConv(GenAlg* const that,
     iGene < that->_NNdata._nbBaseConv * 3; 
     iGene += that->_NNdata._nbBaseCellConv * 3) {
     // Get the gene from one parent or the other with equal probabililty
-    if (rnd() < 0.5) {
+    if (GARngUnif(rng) < 0.5) {
       for (long jGene = that->_NNdata._nbBaseCellConv * 3;
         jGene--;) {
         VecSet(child->_adnF, iGene + jGene, 
@@ -922,7 +2519,7 @@ void GAReproductionNeuraNetConv(GenAlg* const that,
   for (long iGene = that->_NNdata._nbBaseConv * 3; 
     iGene < GAGetLengthAdnFloat(that); iGene += 3) {
     // Get the gene from one parent or the other with equal probabililty
-    if (rnd() < 0.5) {
+    if (GARngUnif(rng) < 0.5) {
       for (long jGene = 3; --jGene;) {
         VecSet(child->_adnF, iGene + jGene, 
           VecGet(parentA->_adnF, iGene + jGene));
@@ -940,14 +2537,12 @@ void GAReproductionNeuraNetConv(GenAlg* const that,
   }
   // Reset the age of the child
   child->_age = 1;
-  // Set the id of the child
-  child->_id = (that->_nextId)++;
 }
 
 // Set the genes of the adn at rank 'iChild' as a 50/50 mix of the 
 // genes of adns at ranks 'parents[0]' and 'parents[1]'
 void GAReproductionDefault(GenAlg* const that, 
-  const int* const parents, const int iChild) {
+  const int* const parents, const int iChild, GARng* const rng) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
@@ -973,7 +2568,7 @@ void GAReproductionDefault(GenAlg* const that,
   // For each gene of the adn for floating point value
   for (long iGene = GAGetLengthAdnFloat(that); iGene--;) {
     // Get the gene from one parent or the other with equal probabililty
-    if (rnd() < 0.5) {
+    if (GARngUnif(rng) < 0.5) {
       VecSet(child->_adnF, iGene, VecGet(parentA->_adnF, iGene));
       VecSet(child->_deltaAdnF, iGene, 
         VecGet(parentA->_deltaAdnF, iGene));
@@ -986,15 +2581,13 @@ void GAReproductionDefault(GenAlg* const that,
   // For each gene of the adn for int value
   for (long iGene = GAGetLengthAdnInt(that); iGene--;) {
     // Get the gene from one parent or the other with equal probabililty
-    if (rnd() < 0.5)
+    if (GARngUnif(rng) < 0.5)
       VecSet(child->_adnI, iGene, VecGet(parentA->_adnI, iGene));
     else
       VecSet(child->_adnI, iGene, VecGet(parentB->_adnI, iGene));
   }
   // Reset the age of the child
   child->_age = 1;
-  // Set the id of the child
-  child->_id = (that->_nextId)++;
 }
 
 // Set the genes of the adn at rank 'iChild' as a mix of the 
@@ -1002,7 +2595,7 @@ void GAReproductionDefault(GenAlg* const that,
 // Version used for Morpheus, links topology stays the same, base
 // functions are averaged betwen parent
 void GAReproductionMorpheus(GenAlg* const that, 
-  const int* const parents, const int iChild) {
+  const int* const parents, const int iChild, GARng* const rng) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
@@ -1021,6 +2614,8 @@ void GAReproductionMorpheus(GenAlg* const that,
     PBErrCatch(GenAlgErr);
   }
 #endif
+  // Morpheus draws no random value
+  (void)rng;
   // Get the parents and child
   GenAlgAdn* parentA = GAAdn(that, parents[0]);
   GenAlgAdn* parentB = GAAdn(that, parents[1]);
@@ -1041,14 +2636,13 @@ void GAReproductionMorpheus(GenAlg* const that,
   VecCopy(child->_adnI, parentA->_adnI);
   // Reset the age of the child
   child->_age = 1;
-  // Set the id of the child
-  child->_id = (that->_nextId)++;
 }
 
 // Router toward the appropriate Mute function according to the type 
 // of GenAlg
+// 'iThread' is the index of the thread executing the mutation
 void GAMute(GenAlg* const that, const int* const parents, 
-  const int iChild) {
+  const int iChild, GARng* const rng, const int iThread) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
@@ -1069,17 +2663,17 @@ void GAMute(GenAlg* const that, const int* const parents,
 #endif
   switch (GAGetType(that)) {
     case genAlgTypeNeuraNet:
-      GAMuteNeuraNet(that, parents, iChild);
+      GAMuteNeuraNet(that, parents, iChild, rng, iThread);
       break;
     case genAlgTypeNeuraNetConv:
-      GAMuteNeuraNetConv(that, parents, iChild);
+      GAMuteNeuraNetConv(that, parents, iChild, rng);
       break;
     case genAlgTypeMorpheus:
-      GAMuteMorpheus(that, parents, iChild);
+      GAMuteMorpheus(that, parents, iChild, rng);
       break;
     case genAlgTypeDefault:
     default:
-      GAMuteDefault(that, parents, iChild);
+      GAMuteDefault(that, parents, iChild, rng);
   }
 }
 
@@ -1087,8 +2681,9 @@ void GAMute(GenAlg* const that, const int* const parents,
 // This version is optimised to calculate the parameters of a NeuraNet
 // by ensuring coherence in links: outputs have at least one link
 // and there is no dead link
+// Use the scratch memory of the thread 'iThread'
 void GAMuteNeuraNet(GenAlg* const that, const int* const parents, 
-  const int iChild) {
+  const int iChild, GARng* const rng, const int iThread) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
@@ -1120,19 +2715,21 @@ void GAMuteNeuraNet(GenAlg* const that, const int* const parents,
     probMute = PBMATH_EPSILON;
   // Declare a variable to memorize if there has been mutation
   bool hasMuted = false;
-  // Declare a variable to memorize the used values amongst input and 
-  // hidden
+  // Get the flags of the used values amongst input and hidden in the
+  // scratch memory of the thread
   long nbMaxUsedVal = that->_NNdata._nbIn + that->_NNdata._nbHid;
-  char* isUsed = PBErrMalloc(GenAlgErr, sizeof(char) * nbMaxUsedVal);
+  char* isUsed = that->_scratch[iThread]._isUsed;
+  // Reset the used values, they are modified only by a mutation so 
+  // they don't need to be reset when looping
+  memset(isUsed, 0, sizeof(char) * nbMaxUsedVal);
+  memset(isUsed, 1, sizeof(char) * that->_NNdata._nbIn);
   // Loop until there has been at least one mutation
   do {
-    // Reset the used values
-    memset(isUsed, 0, sizeof(char) * nbMaxUsedVal);
-    memset(isUsed, 1, sizeof(char) * that->_NNdata._nbIn);
     // For each gene of the adn for int value (links definitions)
     for (long iGene = 0; iGene < GAGetLengthAdnInt(that); iGene += 3) {
       // If the link mutes
-      if (that->_NNdata._flagMutableLink == true && rnd() < probMute) {
+      if (that->_NNdata._flagMutableLink == true && 
+        GARngUnif(rng) < probMute) {
         hasMuted = true;
         // If this link is currently inactivated
         if (GAAdnGetGeneI(child, iGene) == -1) {
@@ -1148,20 +2745,21 @@ void GAMuteNeuraNet(GenAlg* const that, const int* const parents,
           // Ensure the input is a used value
           do {
             val = (long)round((float)min + 
-              (float)(max - min) * rnd());
+              (float)(max - min) * GARngUnif(rng));
           } while (isUsed[val] == 0);
           GAAdnSetGeneI(child, iGene + 1, val);
           // Output
           min = MAX(val, VecGet(GABoundsAdnInt(that, iGene + 2), 0));
           max = VecGet(GABoundsAdnInt(that, iGene + 2), 1);
-          val = (long)round((float)min + (float)(max - min) * rnd());
+          val = (long)round((float)min + 
+            (float)(max - min) * GARngUnif(rng));
           GAAdnSetGeneI(child, iGene + 2, val);
           if (val < nbMaxUsedVal)
             isUsed[val] = 1;
         // Else, this link is currently activated
         } else {
           // Choose between inactivation or mutation
-          if (rnd() < 0.5) {
+          if (GARngUnif(rng) < 0.5) {
             // Inactivate the link
             GAAdnSetGeneI(child, iGene, -1);
           } else {
@@ -1174,13 +2772,14 @@ void GAMuteNeuraNet(GenAlg* const that, const int* const parents,
             // Ensure the input is a used value
             do {
               val = (long)round((float)min + 
-                (float)(max - min) * rnd());
+                (float)(max - min) * GARngUnif(rng));
             } while (isUsed[val] == 0);
             GAAdnSetGeneI(child, iGene + 1, val);
             // Output
             min = MAX(val, VecGet(GABoundsAdnInt(that, iGene + 2), 0));
             max = VecGet(GABoundsAdnInt(that, iGene + 2), 1);
-            val = (long)round((float)min + (float)(max - min) * rnd());
+            val = (long)round((float)min + 
+              (float)(max - min) * GARngUnif(rng));
             GAAdnSetGeneI(child, iGene + 2, val);
             if (val < nbMaxUsedVal)
               isUsed[val] = 1;
@@ -1192,7 +2791,7 @@ void GAMuteNeuraNet(GenAlg* const that, const int* const parents,
       // If the link is active
       if (baseFun != -1) {
         // If the associated base function mutes
-        if (rnd() < probMute) {
+        if (GARngUnif(rng) < probMute) {
           hasMuted = true;
           long baseFunGene = baseFun * 3;
           for (long jGene = 3; jGene--;) {
@@ -1206,7 +2805,7 @@ void GAMuteNeuraNet(GenAlg* const that, const int* const parents,
             GAAdnSetGeneF(child, baseFunGene + jGene, 
               GAAdnGetGeneF(child, baseFunGene + jGene) + 
               (VecGet(bounds, 1) - VecGet(bounds, 0)) * amp * 
-              (rnd() - 0.5) + 
+              (GARngUnif(rng) - 0.5) + 
               GAAdnGetDeltaGeneF(child, baseFunGene + jGene));
             // Keep the gene value in bounds
             while (GAAdnGetGeneF(child, baseFunGene + jGene) < 
@@ -1232,13 +2831,12 @@ void GAMuteNeuraNet(GenAlg* const that, const int* const parents,
       }
     }
   } while (hasMuted == false);
-  free(isUsed);
 }
 
 // Mute the genes of the entity at rank 'iChild'
 // Version for Morpheus
 void GAMuteMorpheus(GenAlg* const that, const int* const parents, 
-  const int iChild) {
+  const int iChild, GARng* const rng) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
@@ -1278,7 +2876,7 @@ void GAMuteMorpheus(GenAlg* const that, const int* const parents,
       GAAdnSetGeneF(child, baseFunGene + jGene, 
         GAAdnGetGeneF(child, baseFunGene + jGene) + 
         (VecGet(bounds, 1) - VecGet(bounds, 0)) * amp * 
-        (rnd() - 0.5) + 
+        (GARngUnif(rng) - 0.5) + 
         GAAdnGetDeltaGeneF(child, baseFunGene + jGene));
       // Keep the gene value in bounds
       while (GAAdnGetGeneF(child, baseFunGene + jGene) < 
@@ -1305,7 +2903,7 @@ void GAMuteMorpheus(GenAlg* const that, const int* const parents,
 
 // Mute the genes of the entity at rank 'iChild'
 void GAMuteDefault(GenAlg* const that, const int* const parents, 
-  const int iChild) {
+  const int iChild, GARng* const rng) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
@@ -1335,70 +2933,175 @@ void GAMuteDefault(GenAlg* const that, const int* const parents,
   probMute += (float)(parentA->_age) / 10000;
   if (probMute < PBMATH_EPSILON)
     probMute = PBMATH_EPSILON;
+  // If the probability of mutation is low, sample directly the 
+  // indices of the mutating genes among the genes for floating point 
+  // values followed by the genes for integer values, the first one 
+  // being drawn such as there is at least one mutation
+  if (probMute < GENALG_MUTE_SPARSE_PROB) {
+    long lengthF = GAGetLengthAdnFloat(that);
+    long nbGene = lengthF + GAGetLengthAdnInt(that);
+    GAMuteSampler sampler;
+    for (long iGene = 
+      GAMuteSamplerFirst(&sampler, rng, probMute, nbGene);
+      iGene < nbGene; iGene = GAMuteSamplerNext(&sampler, rng)) {
+      if (iGene < lengthF)
+        GAMuteGeneF(that, child, iGene, amp, rng);
+      else
+        GAMuteGeneI(that, child, iGene - lengthF, amp, rng);
+    }
+    return;
+  }
   bool hasMuted = false;
+  // Declare buffers for the random values of a block of genes
+  float draw[GENALG_MUTE_BLOCK];
+  float noise[GENALG_MUTE_BLOCK];
   do {
-    // For each gene of the adn for floating point value
-    for (long iGene = GAGetLengthAdnFloat(that); iGene--;) {
-      // If this gene mutes
-      if (rnd() < probMute) {
-        hasMuted = true;
-        // Get the bounds
-        const VecFloat2D* const bounds = GABoundsAdnFloat(that, iGene);
-        // Declare a variable to memorize the previous value of the gene
-        float prevVal = GAAdnGetGeneF(child, iGene);
-        // Apply the mutation
-        GAAdnSetGeneF(child, iGene, GAAdnGetGeneF(child, iGene) + 
-          (VecGet(bounds, 1) - VecGet(bounds, 0)) * amp * 
-          (rnd() - 0.5) + GAAdnGetDeltaGeneF(child, iGene));
-        // Keep the gene value in bounds
-        while (GAAdnGetGeneF(child, iGene) < VecGet(bounds, 0) ||
-          GAAdnGetGeneF(child, iGene) > VecGet(bounds, 1)) {
-          if (GAAdnGetGeneF(child, iGene) > VecGet(bounds, 1))
-            GAAdnSetGeneF(child, iGene, 
-              2.0 * VecGet(bounds, 1) - GAAdnGetGeneF(child, iGene));
-          else if (GAAdnGetGeneF(child, iGene) < VecGet(bounds, 0))
-            GAAdnSetGeneF(child, iGene, 
-              2.0 * VecGet(bounds, 0) - GAAdnGetGeneF(child, iGene));
-        }
-        // Update the deltaAdn
-        GAAdnSetDeltaGeneF(child, iGene, 
-          GAAdnGetGeneF(child, iGene) - prevVal);
+    // For each block of genes of the adn for floating point value
+    for (long iGene = 0; iGene < GAGetLengthAdnFloat(that); 
+      iGene += GENALG_MUTE_BLOCK) {
+      long nb = MIN(GENALG_MUTE_BLOCK, 
+        GAGetLengthAdnFloat(that) - iGene);
+      // Draw the random values of the block
+      for (long jGene = 0; jGene < nb; ++jGene) {
+        draw[jGene] = GARngUnif(rng);
+        noise[jGene] = GARngUnif(rng) - 0.5;
       }
+      // Mute the block
+      if (GAMuteKernelF(child->_adnF->_val + iGene, 
+        child->_deltaAdnF->_val + iGene, that->_boundsMinF + iGene,
+        that->_boundsMaxF + iGene, draw, noise, probMute, amp, 
+        nb) > 0)
+        hasMuted = true;
     }
     // For each gene of the adn for int value
     for (long iGene = GAGetLengthAdnInt(that); iGene--;) {
       // If this gene mutes
-      if (rnd() < probMute) {
+      if (GARngUnif(rng) < probMute) {
         hasMuted = true;
-        // Get the bounds
-        const VecLong2D* const boundsI = GABoundsAdnInt(that, iGene);
-        VecFloat2D bounds = VecLongToFloat2D(boundsI);
-        // Apply the mutation (as it is int value, ensure the amplitude
-        // is big enough to have an effect
-        float ampI = MIN(2.0, 
-          (float)(VecGet(&bounds, 1) - VecGet(&bounds, 0)) * amp);
-        GAAdnSetGeneI(child, iGene, GAAdnGetGeneI(child, iGene) +
-          (long)round(ampI * (rnd() - 0.5)));
-        // Keep the gene value in bounds
-        while (GAAdnGetGeneI(child, iGene) < VecGet(&bounds, 0) ||
-          GAAdnGetGeneI(child, iGene) > VecGet(&bounds, 1)) {
-          if (GAAdnGetGeneI(child, iGene) > VecGet(&bounds, 1))
-            GAAdnSetGeneI(child, iGene, 
-              2 * VecGet(&bounds, 1) - GAAdnGetGeneI(child, iGene));
-          else if (GAAdnGetGeneI(child, iGene) < VecGet(&bounds, 0))
-            GAAdnSetGeneI(child, iGene, 
-              2 * VecGet(&bounds, 0) - GAAdnGetGeneI(child, iGene));
-        }
+        GAMuteGeneI(that, child, iGene, amp, rng);
       }
     }
   } while (hasMuted == false);
 }
 
+// Mute the 'nb' floating point genes 'adn' with deltas 'delta' and 
+// bounds 'min', 'max', using the random values 'draw' (the gene 
+// mutes if its draw is below 'probMute') and 'noise' (in [-0.5,0.5[)
+// and the amplitude 'amp'
+// Genes out of bounds after mutation are reflected into the bounds
+// Return the number of muted genes
+// The loop has no branch, no call and no double precision operation 
+// so it can be vectorized by the compiler
+long GAMuteKernelF(float* const restrict adn, 
+  float* const restrict delta, const float* const restrict min, 
+  const float* const restrict max, const float* const restrict draw, 
+  const float* const restrict noise, const float probMute, 
+  const float amp, const long nb) {
+  long nbMuted = 0;
+  for (long iGene = 0; iGene < nb; ++iGene) {
+    // Apply the mutation
+    float range = max[iGene] - min[iGene];
+    float prev = adn[iGene];
+    float val = prev + range * amp * noise[iGene] + delta[iGene];
+    // Reflect the value into the bounds, the triangle wave of period 
+    // twice the range is the closed form of the successive bounces
+    // As the wave is even the distance to the lower bound can be 
+    // used, and as the mutation moves the gene by a few ranges at 
+    // most the truncation to int doesn't overflow
+    float period = 2.0f * range;
+    float t = fabsf(val - min[iGene]);
+    t -= period * (float)(int)(t / period);
+    float reflected = min[iGene] + range - fabsf(t - range);
+    val = (val < min[iGene] ? reflected : val);
+    val = (val > max[iGene] ? reflected : val);
+    // Update the gene and its delta if it mutes, the update is 
+    // weighted by the mute flag instead of being conditional to 
+    // avoid a branch
+    float mute = (draw[iGene] < probMute ? 1.0f : 0.0f);
+    adn[iGene] = prev + mute * (val - prev);
+    delta[iGene] += mute * (val - prev - delta[iGene]);
+    nbMuted += (mute != 0.0f);
+  }
+  return nbMuted;
+}
+
+// Start the GAMuteSampler 'that' for 'nb' genes mutating with the 
+// probability 'prob' (in ]0,1[) and return the index of the first 
+// mutating gene
+// The first index is drawn conditionally to at least one mutation, 
+// so it is always lower than 'nb'
+long GAMuteSamplerFirst(GAMuteSampler* const that, GARng* const rng,
+  const float prob, const long nb) {
+  that->_nb = nb;
+  that->_logNoMute = log1p(-(double)prob);
+  // Probability of at least one mutation among the 'nb' genes
+  double probAny = -expm1((double)nb * that->_logNoMute);
+  // Invert the cumulative distribution of the index of the first 
+  // mutating gene knowing there is at least one
+  double iGene = floor(log1p(-(double)GARngUnif(rng) * probAny) / 
+    that->_logNoMute);
+  // Guard against the rounding errors
+  that->_iGene = (iGene < (double)nb ? (long)iGene : nb - 1);
+  return that->_iGene;
+}
+
+// Return the index of the next mutating gene of the GAMuteSampler 
+// 'that', or its number of genes if there is no more mutating gene
+long GAMuteSamplerNext(GAMuteSampler* const that, GARng* const rng) {
+  // Draw the number of non mutating genes before the next mutating
+  // one from the geometric distribution
+  double skip = floor(log1p(-(double)GARngUnif(rng)) / 
+    that->_logNoMute);
+  if (skip >= (double)(that->_nb - that->_iGene - 1))
+    that->_iGene = that->_nb;
+  else
+    that->_iGene += 1 + (long)skip;
+  return that->_iGene;
+}
+
+// Mute the 'iGene'-th gene for floating point values of the 
+// GenAlgAdn 'child' of the GenAlg 'that' with the amplitude 'amp'
+void GAMuteGeneF(const GenAlg* const that, GenAlgAdn* const child, 
+  const long iGene, const float amp, GARng* const rng) {
+  // Use the kernel on this gene only, with a draw forcing the 
+  // mutation
+  float draw = 0.0;
+  float noise = GARngUnif(rng) - 0.5;
+  GAMuteKernelF(child->_adnF->_val + iGene, 
+    child->_deltaAdnF->_val + iGene, that->_boundsMinF + iGene,
+    that->_boundsMaxF + iGene, &draw, &noise, 1.0, amp, 1);
+}
+
+// Mute the 'iGene'-th gene for integer values of the GenAlgAdn 
+// 'child' of the GenAlg 'that' with the amplitude 'amp'
+void GAMuteGeneI(const GenAlg* const that, GenAlgAdn* const child, 
+  const long iGene, const float amp, GARng* const rng) {
+  // Get the bounds
+  const VecLong2D* const boundsI = GABoundsAdnInt(that, iGene);
+  VecFloat2D bounds = VecLongToFloat2D(boundsI);
+  // Apply the mutation (as it is int value, ensure the amplitude
+  // is big enough to have an effect
+  float ampI = MIN(2.0, 
+    (float)(VecGet(&bounds, 1) - VecGet(&bounds, 0)) * amp);
+  GAAdnSetGeneI(child, iGene, GAAdnGetGeneI(child, iGene) +
+    (long)round(ampI * (GARngUnif(rng) - 0.5)));
+  // Keep the gene value in bounds
+  while (GAAdnGetGeneI(child, iGene) < VecGet(&bounds, 0) ||
+    GAAdnGetGeneI(child, iGene) > VecGet(&bounds, 1)) {
+    if (GAAdnGetGeneI(child, iGene) > VecGet(&bounds, 1))
+      GAAdnSetGeneI(child, iGene, 
+        2 * VecGet(&bounds, 1) - GAAdnGetGeneI(child, iGene));
+    else if (GAAdnGetGeneI(child, iGene) < VecGet(&bounds, 0))
+      GAAdnSetGeneI(child, iGene, 
+        2 * VecGet(&bounds, 0) - GAAdnGetGeneI(child, iGene));
+  }
+}
+
 // Mute the genes of the entity at rank 'iChild'
 // This version is optimised to calculate the parameters of a NeuraNet
 // with convolution by muting bases function per cell
 void GAMuteNeuraNetConv(GenAlg* const that, const int* const parents, 
-  const int iChild) {
+  const int iChild, GARng* const rng) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
@@ -1430,32 +3133,30 @@ void GAMuteNeuraNetConv(GenAlg* const that, const int* const parents,
   bool hasMuted = false;
   int nbTry = 0;
   do {
-    // For each gene of the adn for floating point value
-    for (long iGene = GAGetLengthAdnFloat(that); iGene--;) {
-      // If this gene mutes
-      if (rnd() < probMute * VecGet(parentA->_mutabilityF, iGene)) {
-        hasMuted = true;
-        // Get the bounds
-        const VecFloat2D* const bounds = GABoundsAdnFloat(that, iGene);
-        // Declare a variable to memorize the previous value of the gene
-        float prevVal = GAAdnGetGeneF(child, iGene);
-        // Apply the mutation
-        GAAdnSetGeneF(child, iGene, GAAdnGetGeneF(child, iGene) + 
-          (VecGet(bounds, 1) - VecGet(bounds, 0)) * amp * 
-          (rnd() - 0.5) + GAAdnGetDeltaGeneF(child, iGene));
-        // Keep the gene value in bounds
-        while (GAAdnGetGeneF(child, iGene) < VecGet(bounds, 0) ||
-          GAAdnGetGeneF(child, iGene) > VecGet(bounds, 1)) {
-          if (GAAdnGetGeneF(child, iGene) > VecGet(bounds, 1))
-            GAAdnSetGeneF(child, iGene, 
-              2.0 * VecGet(bounds, 1) - GAAdnGetGeneF(child, iGene));
-          else if (GAAdnGetGeneF(child, iGene) < VecGet(bounds, 0))
-            GAAdnSetGeneF(child, iGene, 
-              2.0 * VecGet(bounds, 0) - GAAdnGetGeneF(child, iGene));
+    // If the probability of mutation is low, sample directly the 
+    // indices of the candidate genes, which then mute according to
+    // their mutability (mutabilities above 1 are treated as 1)
+    if (probMute < GENALG_MUTE_SPARSE_PROB) {
+      long lengthF = GAGetLengthAdnFloat(that);
+      GAMuteSampler sampler;
+      for (long iGene = 
+        GAMuteSamplerFirst(&sampler, rng, probMute, lengthF);
+        iGene < lengthF; iGene = GAMuteSamplerNext(&sampler, rng)) {
+        float mutability = VecGet(parentA->_mutabilityF, iGene);
+        if (mutability >= 1.0 || GARngUnif(rng) < mutability) {
+          hasMuted = true;
+          GAMuteGeneF(that, child, iGene, amp, rng);
+        }
+      }
+    } else {
+      // For each gene of the adn for floating point value
+      for (long iGene = GAGetLengthAdnFloat(that); iGene--;) {
+        // If this gene mutes
+        if (GARngUnif(rng) < 
+          probMute * VecGet(parentA->_mutabilityF, iGene)) {
+          hasMuted = true;
+          GAMuteGeneF(that, child, iGene, amp, rng);
         }
-        // Update the deltaAdn
-        GAAdnSetDeltaGeneF(child, iGene, 
-          GAAdnGetGeneF(child, iGene) - prevVal);
       }
     }
     ++nbTry;
@@ -1533,38 +3234,40 @@ void GAUpdateNormRange(GenAlg* const that) {
 #endif
   // If there are float adn
   if (GAGetLengthAdnFloat(that) > 0) {
-    // Declare a vector to memorize the ranges in float gene values
-    VecFloat* range = VecFloatCreate(GAGetLengthAdnFloat(that)); 
-    // Calculate the ranges in gene values
-    for (long iGene = GAGetLengthAdnFloat(that); iGene--;)
-      VecSet(range, iGene, 
-        VecGet(GABoundsAdnFloat(that, iGene), 1) - 
-        VecGet(GABoundsAdnFloat(that, iGene), 0));
-    // Calculate the norm of the range
-    that->_normRangeFloat = VecNorm(range);
-    // Free memory
-    VecFree(&range);
+    // Calculate the norm of the ranges in gene values, directly from 
+    // the bounds
+    float sum = 0.0;
+    for (long iGene = 0; iGene < GAGetLengthAdnFloat(that); ++iGene) {
+      float range = VecGet(GABoundsAdnFloat(that, iGene), 1) - 
+        VecGet(GABoundsAdnFloat(that, iGene), 0);
+      sum += range * range;
+    }
+    that->_normRangeFloat = sqrt(sum);
   }
 
   // If there are int adn
   if (GAGetLengthAdnInt(that) > 0) {
-    // Declare a vector to memorize the ranges in int gene values
-    VecFloat* range = VecFloatCreate(GAGetLengthAdnInt(that)); 
-    // Calculate the ranges in gene values
-    for (long iGene = GAGetLengthAdnInt(that); iGene--;)
-      VecSet(range, iGene, 
-        VecGet(GABoundsAdnInt(that, iGene), 1) - 
+    // Calculate the norm of the ranges in gene values, directly from 
+    // the bounds
+    float sum = 0.0;
+    for (long iGene = 0; iGene < GAGetLengthAdnInt(that); ++iGene) {
+      float range = (float)(VecGet(GABoundsAdnInt(that, iGene), 1) - 
         VecGet(GABoundsAdnInt(that, iGene), 0));
-    // Calculate the norm of the range
-    that->_normRangeInt = VecNorm(range);
-    // Free memory
-    VecFree(&range);
+      sum += range * range;
+    }
+    that->_normRangeInt = sqrt(sum);
   }
+  // The diversities depend on the norm of the range
+  GAResetEliteDiversity(that);
+  // The bounds are only saved in the full snapshots
+  GAResetCheckpoint(that);
 }
 
 
-// Get the diversity value of 'adnA' against 'adnB'
-// The diversity is equal to 
+// Get the diversity value of 'adnA' against 'adnB' of the GenAlg 'ga'
+// The diversity is the euclidean distance between the genes 
+// normalised by the range of the genes, averaged over the genes for 
+// floating point and integer values
 float GAAdnGetDiversity(const GenAlgAdn* const adnA, 
   const GenAlgAdn* const adnB, const GenAlg* const ga) {
 #if BUILDMODE == 0
@@ -1578,39 +3281,383 @@ float GAAdnGetDiversity(const GenAlgAdn* const adnA,
     sprintf(GenAlgErr->_msg, "'adnB' is null");
     PBErrCatch(GenAlgErr);
   }
+  if (ga == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'ga' is null");
+    PBErrCatch(GenAlgErr);
+  }
 #endif
   // Declare a variable to memorize the result
   float diversity = 0.0;
   // If there are adn for floating point values
-  if (GAAdnAdnF(adnA) != NULL && GAAdnAdnF(adnB) != NULL) {
-    // Get the difference in adn with the first entity
-    VecFloat* diff = 
-      VecGetOp(GAAdnAdnF(adnA), 1.0, GAAdnAdnF(adnB), -1.0);
-    // Calculate the diversity
-    diversity += VecNorm(diff) / ga->_normRangeFloat;
-    // Free memory
-    VecFree(&diff);
+  bool hasF = (GAAdnAdnF(adnA) != NULL && GAAdnAdnF(adnB) != NULL);
+  if (hasF) {
+    // Calculate the diversity directly on the genes
+    diversity += sqrt(GAGetSqDistF(GAAdnAdnF(adnA)->_val, 
+      GAAdnAdnF(adnB)->_val, VecGetDim(GAAdnAdnF(adnA)))) / 
+      ga->_normRangeFloat;
   }
   // If there are adn for int values
-  if (GAAdnAdnI(adnA) != NULL && GAAdnAdnI(adnB) != NULL) {
-    // Get the difference in adn with the first entity
-    VecLong* diffI = 
-      VecGetOp(GAAdnAdnI(adnA), 1, GAAdnAdnI(adnB), -1);
-    VecFloat* diff = VecLongToFloat(diffI);
-    // Calculate the diversity
-    diversity += VecNorm(diff) / ga->_normRangeInt;
-    // Free memory
-    VecFree(&diffI);
-    VecFree(&diff);
+  bool hasI = (GAAdnAdnI(adnA) != NULL && GAAdnAdnI(adnB) != NULL);
+  if (hasI) {
+    // Calculate the diversity directly on the genes
+    diversity += sqrt(GAGetSqDistI(GAAdnAdnI(adnA)->_val, 
+      GAAdnAdnI(adnB)->_val, VecGetDim(GAAdnAdnI(adnA)))) / 
+      ga->_normRangeInt;
   }
   // Correct diversity if there was both float and int adns
-  if (GAAdnAdnF(adnA) != NULL && GAAdnAdnF(adnB) != NULL && 
-    GAAdnAdnI(adnA) != NULL && GAAdnAdnI(adnB) != NULL)
+  if (hasF && hasI)
     diversity /= 2.0;
   // Return the result
   return diversity;
 }
 
+// Return the squared euclidean distance between the 'nb' floating 
+// point values 'a' and 'b'
+// The sum is split over several accumulators so it can be vectorized
+// by the compiler without reordering the operations of a single sum
+float GAGetSqDistF(const float* const restrict a, 
+  const float* const restrict b, const long nb) {
+  float acc[8] = {0.0};
+  long iVal = 0;
+  for (; iVal + 8 <= nb; iVal += 8) {
+    for (int j = 0; j < 8; ++j) {
+      float d = a[iVal + j] - b[iVal + j];
+      acc[j] += d * d;
+    }
+  }
+  float sum = 0.0;
+  for (; iVal < nb; ++iVal) {
+    float d = a[iVal] - b[iVal];
+    sum += d * d;
+  }
+  for (int j = 0; j < 8; ++j)
+    sum += acc[j];
+  return sum;
+}
+
+// Return the squared euclidean distance between the 'nb' integer 
+// values 'a' and 'b'
+float GAGetSqDistI(const long* const restrict a, 
+  const long* const restrict b, const long nb) {
+  float sum = 0.0;
+  for (long iVal = 0; iVal < nb; ++iVal) {
+    float d = (float)(a[iVal] - b[iVal]);
+    sum += d * d;
+  }
+  return sum;
+}
+
+// Get the diversity of the GenAlgAdn 'adn' against each elite of the 
+// GenAlg 'that'
+// The result is stored in 'diversities' which must be an array of 
+// at least GAGetNbElites(that) floats, the i-th value being the 
+// diversity against the elite of rank i
+void GAGetDiversityToElites(const GenAlg* const that, 
+  const GenAlgAdn* const adn, float* const diversities) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (adn == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'adn' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (diversities == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'diversities' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // Loop on the elites
+  for (int iElite = 0; iElite < GAGetNbElites(that); ++iElite)
+    diversities[iElite] = 
+      GAAdnGetDiversity(adn, GAAdn(that, iElite), that);
+}
+
+// Update the matrix of diversity between the elites of the GenAlg 
+// 'that'
+// Only the elites which were not elites at the previous update are 
+// recalculated, the elites are identified by their id
+void GAUpdateEliteDiversity(GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  GAEliteDiversity* const div = &(that->_eliteDiversity);
+  int nb = GAGetNbElites(that);
+  // If the number of elites has changed, reallocate the matrix
+  if (nb != div->_nb) {
+    free(div->_div);
+    free(div->_ids);
+    free(div->_flagUpToDate);
+    free(div->_adns);
+    free(div->_newAdns);
+    div->_div = PBErrMalloc(GenAlgErr, sizeof(float) * nb * nb);
+    div->_ids = PBErrMalloc(GenAlgErr, sizeof(unsigned long) * nb);
+    div->_flagUpToDate = PBErrMalloc(GenAlgErr, sizeof(bool) * nb);
+    div->_adns = PBErrMalloc(GenAlgErr, sizeof(GenAlgAdn*) * nb);
+    div->_newAdns = PBErrMalloc(GenAlgErr, sizeof(GenAlgAdn*) * nb);
+    div->_nb = nb;
+    for (int iSlot = nb; iSlot--;)
+      div->_flagUpToDate[iSlot] = false;
+  }
+  // Put back in their slot the elites which were already elites
+  for (int iSlot = nb; iSlot--;)
+    div->_adns[iSlot] = NULL;
+  int nbNew = 0;
+  for (int iRank = 0; iRank < nb; ++iRank) {
+    const GenAlgAdn* adn = GAAdn(that, iRank);
+    int iSlot = nb - 1;
+    while (iSlot >= 0 && (div->_flagUpToDate[iSlot] == false || 
+      div->_adns[iSlot] != NULL || div->_ids[iSlot] != adn->_id))
+      --iSlot;
+    if (iSlot >= 0)
+      div->_adns[iSlot] = adn;
+    else
+      div->_newAdns[nbNew++] = adn;
+  }
+  // Put the new elites in the free slots
+  div->_nbUpdated = nbNew;
+  for (int iSlot = 0; iSlot < nb && nbNew > 0; ++iSlot) {
+    if (div->_adns[iSlot] == NULL) {
+      div->_adns[iSlot] = div->_newAdns[--nbNew];
+      div->_ids[iSlot] = div->_adns[iSlot]->_id;
+      div->_flagUpToDate[iSlot] = false;
+    }
+  }
+  // Recalculate the diversities of the new elites
+  for (int iSlot = 0; iSlot < nb; ++iSlot) {
+    if (div->_flagUpToDate[iSlot] == false) {
+      div->_div[iSlot * nb + iSlot] = 0.0;
+      for (int jSlot = 0; jSlot < nb; ++jSlot) {
+        // Pairs of new elites are calculated only once
+        if (jSlot != iSlot && (div->_flagUpToDate[jSlot] == true || 
+          jSlot > iSlot)) {
+          float d = GAAdnGetDiversity(
+            div->_adns[iSlot], div->_adns[jSlot], that);
+          div->_div[iSlot * nb + jSlot] = d;
+          div->_div[jSlot * nb + iSlot] = d;
+        }
+      }
+    }
+  }
+  // Update the flags and the average and minimum diversity
+  float sum = 0.0;
+  div->_min = (nb > 1 ? div->_div[1] : 0.0);
+  for (int iSlot = 0; iSlot < nb; ++iSlot) {
+    div->_flagUpToDate[iSlot] = true;
+    for (int jSlot = iSlot + 1; jSlot < nb; ++jSlot) {
+      float d = div->_div[iSlot * nb + jSlot];
+      sum += d;
+      if (d < div->_min)
+        div->_min = d;
+    }
+  }
+  div->_avg = (nb > 1 ? sum / (float)(nb * (nb - 1) / 2) : 0.0);
+}
+
+// Invalidate the matrix of diversity between the elites of the 
+// GenAlg 'that' so that it is entirely recalculated at the next 
+// update
+// Must be called if the genes of the elites are modified by the user
+void GAResetEliteDiversity(GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  for (int iSlot = that->_eliteDiversity._nb; iSlot--;)
+    that->_eliteDiversity._flagUpToDate[iSlot] = false;
+}
+
+// Set the maximum number of entries in the fitness cache of the 
+// GenAlg 'that' to 'nb' and empty the cache
+// If 'nb' is 0 (default) the cache is disabled. Else, GAStep records 
+// the values of the new adns in the cache and looks up the genes of 
+// each child: if an adn with the same genes has already been 
+// evaluated its value is reused and the child is not new (cf 
+// GAAdnIsNew). Only use the cache if the evaluation is deterministic
+void GASetFitnessCacheSize(GenAlg* const that, const int nb) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (nb < 0) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'nb' is invalid (%d>=0)", nb);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  GAFitnessCache* cache = &(that->_fitnessCache);
+  GAFitnessCacheFree(cache);
+  if (nb == 0)
+    return;
+  cache->_nbMax = nb;
+  cache->_lengthF = GAGetLengthAdnFloat(that);
+  cache->_lengthI = GAGetLengthAdnInt(that);
+  // Use at least twice more buckets than entries
+  long nbBucket = 1;
+  while (nbBucket < 2 * (long)nb)
+    nbBucket <<= 1;
+  cache->_maskBucket = nbBucket - 1;
+  cache->_buckets = PBErrMalloc(GenAlgErr, sizeof(int) * nbBucket);
+  for (long iBucket = nbBucket; iBucket--;)
+    cache->_buckets[iBucket] = -1;
+  cache->_hashes = PBErrMalloc(GenAlgErr, sizeof(uint64_t) * nb);
+  cache->_vals = PBErrMalloc(GenAlgErr, sizeof(float) * nb);
+  if (cache->_lengthF > 0)
+    cache->_genesF = 
+      PBErrMalloc(GenAlgErr, sizeof(float) * nb * cache->_lengthF);
+  if (cache->_lengthI > 0)
+    cache->_genesI = 
+      PBErrMalloc(GenAlgErr, sizeof(long) * nb * cache->_lengthI);
+  cache->_nextInBucket = PBErrMalloc(GenAlgErr, sizeof(int) * nb);
+  cache->_prev = PBErrMalloc(GenAlgErr, sizeof(int) * nb);
+  cache->_next = PBErrMalloc(GenAlgErr, sizeof(int) * nb);
+  cache->_head = -1;
+  cache->_tail = -1;
+}
+
+// Free the memory used by the GAFitnessCache 'that' and disable it
+void GAFitnessCacheFree(GAFitnessCache* const that) {
+  free(that->_buckets);
+  free(that->_hashes);
+  free(that->_vals);
+  free(that->_genesF);
+  free(that->_genesI);
+  free(that->_nextInBucket);
+  free(that->_prev);
+  free(that->_next);
+  *that = (GAFitnessCache){0};
+}
+
+// Return the hash of the genes of the GenAlgAdn 'adn'
+uint64_t GAFitnessCacheHash(const GAFitnessCache* const that, 
+  const GenAlgAdn* const adn) {
+  uint64_t hash = 0x9E3779B97F4A7C15;
+  for (long iGene = 0; iGene < that->_lengthF; ++iGene) {
+    uint32_t bits = 0;
+    memcpy(&bits, GAAdnAdnF(adn)->_val + iGene, sizeof(uint32_t));
+    hash = (hash ^ bits) * 0xBF58476D1CE4E5B9;
+    hash ^= hash >> 31;
+  }
+  for (long iGene = 0; iGene < that->_lengthI; ++iGene) {
+    hash = (hash ^ (uint64_t)(GAAdnAdnI(adn)->_val[iGene])) * 
+      0x94D049BB133111EB;
+    hash ^= hash >> 31;
+  }
+  return hash;
+}
+
+// Search the genes of the GenAlgAdn 'adn' with hash 'hash' in the 
+// GAFitnessCache 'that'
+// Return the index of the entry, or -1 if it is not in the cache
+int GAFitnessCacheSearch(const GAFitnessCache* const that, 
+  const GenAlgAdn* const adn, const uint64_t hash) {
+  int iEntry = that->_buckets[hash & that->_maskBucket];
+  while (iEntry != -1) {
+    // Compare the genes too, to be safe against collisions
+    if (that->_hashes[iEntry] == hash &&
+      (that->_lengthF == 0 || memcmp(GAAdnAdnF(adn)->_val, 
+        that->_genesF + iEntry * that->_lengthF, 
+        sizeof(float) * that->_lengthF) == 0) &&
+      (that->_lengthI == 0 || memcmp(GAAdnAdnI(adn)->_val, 
+        that->_genesI + iEntry * that->_lengthI, 
+        sizeof(long) * that->_lengthI) == 0))
+      return iEntry;
+    iEntry = that->_nextInBucket[iEntry];
+  }
+  return -1;
+}
+
+// Move the entry 'iEntry' of the GAFitnessCache 'that' to the head
+// of the order of use
+void GAFitnessCacheTouch(GAFitnessCache* const that, const int iEntry) {
+  if (that->_head == iEntry)
+    return;
+  // Unlink the entry if it is in the list
+  if (that->_prev[iEntry] != -1)
+    that->_next[that->_prev[iEntry]] = that->_next[iEntry];
+  if (that->_next[iEntry] != -1)
+    that->_prev[that->_next[iEntry]] = that->_prev[iEntry];
+  if (that->_tail == iEntry)
+    that->_tail = that->_prev[iEntry];
+  // Insert it at the head
+  that->_prev[iEntry] = -1;
+  that->_next[iEntry] = that->_head;
+  if (that->_head != -1)
+    that->_prev[that->_head] = iEntry;
+  that->_head = iEntry;
+  if (that->_tail == -1)
+    that->_tail = iEntry;
+}
+
+// Record the value of the GenAlgAdn 'adn' in the GAFitnessCache 
+// 'that', replacing the least recently used entry if the cache is 
+// full
+void GAFitnessCachePut(GAFitnessCache* const that, 
+  const GenAlgAdn* const adn) {
+  uint64_t hash = GAFitnessCacheHash(that, adn);
+  int iEntry = GAFitnessCacheSearch(that, adn, hash);
+  if (iEntry == -1) {
+    if (that->_nb < that->_nbMax) {
+      // Use a new entry
+      iEntry = (that->_nb)++;
+      that->_prev[iEntry] = -1;
+      that->_next[iEntry] = -1;
+    } else {
+      // Reuse the least recently used entry, removing it from its 
+      // bucket
+      iEntry = that->_tail;
+      int* link = that->_buckets + 
+        (that->_hashes[iEntry] & that->_maskBucket);
+      while (*link != iEntry)
+        link = that->_nextInBucket + *link;
+      *link = that->_nextInBucket[iEntry];
+    }
+    // Add the entry to its bucket
+    long iBucket = hash & that->_maskBucket;
+    that->_nextInBucket[iEntry] = that->_buckets[iBucket];
+    that->_buckets[iBucket] = iEntry;
+    that->_hashes[iEntry] = hash;
+    if (that->_lengthF > 0)
+      memcpy(that->_genesF + iEntry * that->_lengthF, 
+        GAAdnAdnF(adn)->_val, sizeof(float) * that->_lengthF);
+    if (that->_lengthI > 0)
+      memcpy(that->_genesI + iEntry * that->_lengthI, 
+        GAAdnAdnI(adn)->_val, sizeof(long) * that->_lengthI);
+  }
+  that->_vals[iEntry] = GAAdnGetVal(adn);
+  GAFitnessCacheTouch(that, iEntry);
+}
+
+// Look up the GenAlgAdn 'adn' in the GAFitnessCache 'that'
+// Return true and set 'val' to its value if found, else return false
+bool GAFitnessCacheGet(GAFitnessCache* const that, 
+  const GenAlgAdn* const adn, float* const val) {
+  int iEntry = GAFitnessCacheSearch(that, adn, 
+    GAFitnessCacheHash(that, adn));
+  if (iEntry == -1) {
+    ++(that->_nbMiss);
+    return false;
+  }
+  ++(that->_nbHit);
+  *val = that->_vals[iEntry];
+  GAFitnessCacheTouch(that, iEntry);
+  return true;
+}
+
 // Function which return the JSON encoding of 'that' 
 JSONNode* GAAdnEncodeAsJSON(const GenAlgAdn* const that, 
   const float elo) {
@@ -1730,8 +3777,10 @@ JSONNode* GAEncodeAsJSON(const GenAlg* const that) {
   // Save the adns
   JSONArrayStruct setAdn = JSONArrayStructCreateStatic();
   for (int iEnt = 0; iEnt < GAGetNbAdns(that); ++iEnt) {
-    GenAlgAdn* ent = GSetElemData(GSetElement(GAAdns(that), iEnt));
-    float sortVal = GSetElemGetSortVal(GSetElement(GAAdns(that), iEnt));
+    // Adns are saved from the head to the tail of the set
+    GSetElem* elem = that->_ranks[GAGetNbAdns(that) - iEnt - 1];
+    GenAlgAdn* ent = GSetElemData(elem);
+    float sortVal = GSetElemGetSortVal(elem);
     JSONArrayStructAdd(&setAdn, GAAdnEncodeAsJSON(ent, sortVal));
   }
   JSONAddProp(json, "_adns", &setAdn);
@@ -1997,11 +4046,14 @@ bool GADecodeAsJSON(GenAlg** that, const JSONNode* const json) {
     return false;
   for (int iEnt = 0; iEnt < GAGetNbAdns(*that); ++iEnt) {
     JSONNode* val = JSONValue(prop, iEnt);
-    if (!GAAdnDecodeAsJSON(
-      (GenAlgAdn**)&(GSetElement(GAAdns(*that), iEnt)->_data), val)) {
+    // Adns are saved from the head to the tail of the set
+    GSetElem* elem = (*that)->_ranks[GAGetNbAdns(*that) - iEnt - 1];
+    if (!GAAdnDecodeAsJSON((GenAlgAdn**)&(elem->_data), val)) {
       return false;
     }
   }
+  // The adns have been replaced, update the rank index
+  GAUpdateRanks(*that);
   // Decode the best adn
   prop = JSONProperty(json, "_bestAdn");
   if (prop == NULL) {
@@ -2050,6 +4102,8 @@ bool GALoad(GenAlg** that, FILE* const stream) {
 // Save the GenAlg 'that' to the stream 'stream'
 // If 'compact' equals true it saves in compact form, else it saves in 
 // readable form
+// The encoding is the one of GAEncodeAsJSON but it is written 
+// progressively, without creating the JSONNode of the whole GenAlg
 // Return true in case of success, else false
 bool GASave(const GenAlg* const that, FILE* const stream, 
   const bool compact) {
@@ -2065,19 +4119,1059 @@ bool GASave(const GenAlg* const that, FILE* const stream,
     PBErrCatch(GenAlgErr);
   }
 #endif
-  // Get the JSON encoding
-  JSONNode* json = GAEncodeAsJSON(that);
-  // Save the JSON
-  if (!JSONSave(json, stream, compact)) {
-    return false;
-  }
-  // Free memory
-  JSONFree(&json);
-  // Return success code
-  return true;
-}
-
-// Set the flag memorizing if the TextOMeter is displayed for
+  // Write the same encoding as GAEncodeAsJSON, directly on the 
+  // stream to avoid keeping the whole JSONNode in memory
+  GAJSONStream json = {._stream = stream, ._compact = compact, 
+    ._depth = -1};
+  // Declare a buffer to convert value into string
+  char val[100];
+  GAJSONStreamOpen(&json, '{');
+  // Encode the type
+  sprintf(val, "%d", GAGetType(that));
+  GAJSONStreamProp(&json, "_type", val);
+  switch (GAGetType(that)) {
+    case genAlgTypeNeuraNet:
+    case genAlgTypeNeuraNetConv:
+      sprintf(val, "%d", that->_NNdata._nbIn);
+      GAJSONStreamProp(&json, "NN_nbIn", val);
+      sprintf(val, "%d", that->_NNdata._nbHid);
+      GAJSONStreamProp(&json, "NN_nbHid", val);
+      sprintf(val, "%d", that->_NNdata._nbOut);
+      GAJSONStreamProp(&json, "NN_nbOut", val);
+      sprintf(val, "%d", that->_NNdata._flagMutableLink);
+      GAJSONStreamProp(&json, "NN_flagMutablelink", val);
+      if (GAGetType(that) == genAlgTypeNeuraNetConv) {
+        sprintf(val, "%ld", that->_NNdata._nbBaseConv);
+        GAJSONStreamProp(&json, "NN_nbBaseConv", val);
+        sprintf(val, "%ld", that->_NNdata._nbBaseCellConv);
+        GAJSONStreamProp(&json, "NN_nbBaseCellConv", val);
+        sprintf(val, "%ld", that->_NNdata._nbLink);
+        GAJSONStreamProp(&json, "NN_nbLink", val);
+      }
+      break;
+    default:
+      break;
+  }
+  // Encode the nb adns, nb elites, lengths, epoch and next id
+  sprintf(val, "%d", GAGetNbAdns(that));
+  GAJSONStreamProp(&json, "_nbAdns", val);
+  sprintf(val, "%d", GAGetNbElites(that));
+  GAJSONStreamProp(&json, "_nbElites", val);
+  sprintf(val, "%ld", GAGetLengthAdnFloat(that));
+  GAJSONStreamProp(&json, "_lengthAdnF", val);
+  sprintf(val, "%ld", GAGetLengthAdnInt(that));
+  GAJSONStreamProp(&json, "_lengthAdnI", val);
+  sprintf(val, "%lu", GAGetCurEpoch(that));
+  GAJSONStreamProp(&json, "_curEpoch", val);
+  sprintf(val, "%lu", that->_nextId);
+  GAJSONStreamProp(&json, "_nextId", val);
+  // Encode the bounds
+  if (GAGetLengthAdnFloat(that) > 0) {
+    GAJSONStreamKey(&json, "_boundFloat");
+    GAJSONStreamOpen(&json, '[');
+    for (long iBound = 0; iBound < GAGetLengthAdnFloat(that); ++iBound) {
+      GAJSONStreamNext(&json);
+      GAJSONStreamVecFloat(&json, 
+        (const VecFloat*)GABoundsAdnFloat(that, iBound));
+    }
+    GAJSONStreamClose(&json, ']');
+  }
+  if (GAGetLengthAdnInt(that) > 0) {
+    GAJSONStreamKey(&json, "_boundInt");
+    GAJSONStreamOpen(&json, '[');
+    for (long iBound = 0; iBound < GAGetLengthAdnInt(that); ++iBound) {
+      GAJSONStreamNext(&json);
+      GAJSONStreamVecLong(&json, 
+        (const VecLong*)GABoundsAdnInt(that, iBound));
+    }
+    GAJSONStreamClose(&json, ']');
+  }
+  // Save the adns, from the head to the tail of the set
+  GAJSONStreamKey(&json, "_adns");
+  GAJSONStreamOpen(&json, '[');
+  for (int iEnt = 0; iEnt < GAGetNbAdns(that); ++iEnt) {
+    GSetElem* elem = that->_ranks[GAGetNbAdns(that) - iEnt - 1];
+    GAJSONStreamNext(&json);
+    GAJSONStreamAdn(&json, GSetElemData(elem), 
+      GSetElemGetSortVal(elem));
+  }
+  GAJSONStreamClose(&json, ']');
+  // Save the best adn
+  GAJSONStreamKey(&json, "_bestAdn");
+  GAJSONStreamAdn(&json, GABestAdn(that), 0.0);
+  GAJSONStreamClose(&json, '}');
+  fprintf(stream, "\n");
+  // Return success code
+  return (ferror(stream) == 0);
+}
+
+// Open a node (object if 'c' equals '{', array if 'c' equals '[') in 
+// the GAJSONStream 'that'
+void GAJSONStreamOpen(GAJSONStream* const that, const char c) {
+  fputc(c, that->_stream);
+  ++(that->_depth);
+  that->_isEmpty[that->_depth] = true;
+}
+
+// Close the current node (with 'c' equals '}' or ']') in the 
+// GAJSONStream 'that'
+void GAJSONStreamClose(GAJSONStream* const that, const char c) {
+  // If the node has children, close it on its own line
+  if (that->_compact == false && 
+    that->_isEmpty[that->_depth] == false) {
+    fputc('\n', that->_stream);
+    for (int iDepth = that->_depth; iDepth--;)
+      fputs("  ", that->_stream);
+  }
+  fputc(c, that->_stream);
+  --(that->_depth);
+}
+
+// Start a new child of the current node in the GAJSONStream 'that'
+void GAJSONStreamNext(GAJSONStream* const that) {
+  if (that->_isEmpty[that->_depth] == false)
+    fputc(',', that->_stream);
+  that->_isEmpty[that->_depth] = false;
+  // In readable form each child is on its own line
+  if (that->_compact == false) {
+    fputc('\n', that->_stream);
+    for (int iDepth = that->_depth + 1; iDepth--;)
+      fputs("  ", that->_stream);
+  }
+}
+
+// Start the property 'key' of the current object in the GAJSONStream
+// 'that'
+void GAJSONStreamKey(GAJSONStream* const that, const char* const key) {
+  GAJSONStreamNext(that);
+  fprintf(that->_stream, "\"%s\":", key);
+}
+
+// Write the property 'key' with value 'val' in the current object of
+// the GAJSONStream 'that'
+void GAJSONStreamProp(GAJSONStream* const that, const char* const key,
+  const char* const val) {
+  GAJSONStreamKey(that, key);
+  fprintf(that->_stream, "\"%s\"", val);
+}
+
+// Write the VecFloat 'vec' in the GAJSONStream 'that', with the same 
+// encoding as VecEncodeAsJSON
+void GAJSONStreamVecFloat(GAJSONStream* const that, 
+  const VecFloat* const vec) {
+  char val[100];
+  GAJSONStreamOpen(that, '{');
+  sprintf(val, "%ld", VecGetDim(vec));
+  GAJSONStreamProp(that, "_dim", val);
+  GAJSONStreamKey(that, "_val");
+  fputc('[', that->_stream);
+  for (long i = 0; i < VecGetDim(vec); ++i)
+    fprintf(that->_stream, (i > 0 ? ",\"%f\"" : "\"%f\""), 
+      VecGet(vec, i));
+  fputc(']', that->_stream);
+  GAJSONStreamClose(that, '}');
+}
+
+// Write the VecLong 'vec' in the GAJSONStream 'that', with the same 
+// encoding as VecEncodeAsJSON
+void GAJSONStreamVecLong(GAJSONStream* const that, 
+  const VecLong* const vec) {
+  char val[100];
+  GAJSONStreamOpen(that, '{');
+  sprintf(val, "%ld", VecGetDim(vec));
+  GAJSONStreamProp(that, "_dim", val);
+  GAJSONStreamKey(that, "_val");
+  fputc('[', that->_stream);
+  for (long i = 0; i < VecGetDim(vec); ++i)
+    fprintf(that->_stream, (i > 0 ? ",\"%ld\"" : "\"%ld\""), 
+      VecGet(vec, i));
+  fputc(']', that->_stream);
+  GAJSONStreamClose(that, '}');
+}
+
+// Write the GenAlgAdn 'adn' with sort value 'elo' in the GAJSONStream 
+// 'that', with the same encoding as GAAdnEncodeAsJSON
+void GAJSONStreamAdn(GAJSONStream* const that, 
+  const GenAlgAdn* const adn, const float elo) {
+  char val[100];
+  GAJSONStreamOpen(that, '{');
+  sprintf(val, "%lu", adn->_id);
+  GAJSONStreamProp(that, "_id", val);
+  sprintf(val, "%lu", adn->_age);
+  GAJSONStreamProp(that, "_age", val);
+  sprintf(val, "%f", elo);
+  GAJSONStreamProp(that, "_elo", val);
+  sprintf(val, "%f", adn->_val);
+  GAJSONStreamProp(that, "_val", val);
+  if (adn->_adnF != NULL) {
+    GAJSONStreamKey(that, "_adnF");
+    GAJSONStreamVecFloat(that, adn->_adnF);
+    GAJSONStreamKey(that, "_deltaAdnF");
+    GAJSONStreamVecFloat(that, adn->_deltaAdnF);
+  }
+  if (adn->_adnI != NULL) {
+    GAJSONStreamKey(that, "_adnI");
+    GAJSONStreamVecLong(that, adn->_adnI);
+  }
+  GAJSONStreamClose(that, '}');
+}
+
+// Save the GenAlg 'that' to the stream 'stream' as a binary snapshot
+// The snapshot is made of a header, the bounds, the id, age and value
+// of each adn, and the genes of all the adns as raw slabs. It uses 
+// the native endianness, use GASave to exchange between machines
+// Return true in case of success, else false
+bool GASaveBinary(const GenAlg* const that, FILE* const stream) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (stream == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'stream' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  long lengthAdnF = GAGetLengthAdnFloat(that);
+  long lengthAdnI = GAGetLengthAdnInt(that);
+  long nbRow = GAGetNbAdns(that) + 1;
+  // Create the header
+  GASnapshotHeader header;
+  memset(&header, 0, sizeof(GASnapshotHeader));
+  memcpy(header._magic, GENALG_SNAPSHOT_MAGIC, sizeof(header._magic));
+  header._version = GENALG_SNAPSHOT_VERSION;
+  header._endian = GENALG_SNAPSHOT_ENDIAN;
+  header._type = GAGetType(that);
+  header._nbAdns = GAGetNbAdns(that);
+  header._nbElites = GAGetNbElites(that);
+  header._nbIn = that->_NNdata._nbIn;
+  header._nbHid = that->_NNdata._nbHid;
+  header._nbOut = that->_NNdata._nbOut;
+  header._flagMutableLink = that->_NNdata._flagMutableLink;
+  header._lengthAdnF = lengthAdnF;
+  header._lengthAdnI = lengthAdnI;
+  header._nbBaseConv = that->_NNdata._nbBaseConv;
+  header._nbBaseCellConv = that->_NNdata._nbBaseCellConv;
+  header._nbLink = that->_NNdata._nbLink;
+  header._curEpoch = GAGetCurEpoch(that);
+  header._nextId = that->_nextId;
+  header._seed = GAGetSeed(that);
+  header._size = GASnapshotGetSize(&header);
+  bool ret = (fwrite(&header, sizeof(GASnapshotHeader), 1, stream) == 1);
+  // Save the bounds
+  if (lengthAdnF > 0) {
+    ret = ret && 
+      fwrite(that->_boundsMinF, sizeof(float), lengthAdnF, stream) == 
+        (size_t)lengthAdnF &&
+      fwrite(that->_boundsMaxF, sizeof(float), lengthAdnF, stream) == 
+        (size_t)lengthAdnF;
+  }
+  for (long iGene = 0; ret && iGene < lengthAdnI; ++iGene) {
+    int64_t bounds[2] = {VecGet(GABoundsAdnInt(that, iGene), 0),
+      VecGet(GABoundsAdnInt(that, iGene), 1)};
+    ret = (fwrite(bounds, sizeof(int64_t), 2, stream) == 2);
+  }
+  // Save the adns
+  ret = ret && GASnapshotWriteAdns(that, stream) &&
+    GASnapshotWriteGenes(that, stream, NULL, nbRow);
+  // Return the success code
+  return ret;
+}
+
+// Load the GenAlg 'that' from the binary snapshot at the current 
+// position of the stream 'stream'
+// If the stream is a regular file it is memory mapped and the genes 
+// are copied directly from the mapping, else it is read
+// On success the stream is positioned after the snapshot
+// If the GenAlg is already allocated, it is freed before loading
+// Return true in case of success, else false
+bool GALoadBinary(GenAlg** that, FILE* const stream) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (stream == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'stream' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  uint64_t sizeSnapshot = 0;
+  // If the stream is a regular file, map it in memory
+  long pos = ftell(stream);
+  int fd = fileno(stream);
+  struct stat st;
+  if (pos >= 0 && fd >= 0 && fstat(fd, &st) == 0 && 
+    S_ISREG(st.st_mode) && st.st_size > pos) {
+    void* map = 
+      mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map != MAP_FAILED) {
+      madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+      bool ret = GASnapshotDecode(that, (const char*)map + pos, 
+        (size_t)(st.st_size - pos), &sizeSnapshot);
+      munmap(map, (size_t)st.st_size);
+      // Position the stream after the snapshot
+      if (ret)
+        ret = (fseek(stream, pos + (long)sizeSnapshot, SEEK_SET) == 0);
+      return ret;
+    }
+  }
+  // Else, read the snapshot in memory, checking its header before 
+  // allocating the memory for its size
+  GASnapshotHeader header;
+  if (fread(&header, sizeof(GASnapshotHeader), 1, stream) != 1 ||
+    GASnapshotCheckHeader(&header, SIZE_MAX) == false)
+    return false;
+  char* data = malloc((size_t)header._size);
+  if (data == NULL)
+    return false;
+  memcpy(data, &header, sizeof(GASnapshotHeader));
+  size_t sizeData = sizeof(GASnapshotHeader) + 
+    fread(data + sizeof(GASnapshotHeader), 1, 
+      (size_t)header._size - sizeof(GASnapshotHeader), stream);
+  bool ret = GASnapshotDecode(that, data, sizeData, &sizeSnapshot);
+  free(data);
+  return ret;
+}
+
+// Return the size in bytes of the binary snapshot described by 
+// 'header'
+uint64_t GASnapshotGetSize(const GASnapshotHeader* const header) {
+  uint64_t nbRow = (uint64_t)header->_nbAdns + 1;
+  uint64_t lengthAdnF = (uint64_t)header->_lengthAdnF;
+  uint64_t lengthAdnI = (uint64_t)header->_lengthAdnI;
+  return sizeof(GASnapshotHeader) + 
+    2 * lengthAdnF * sizeof(float) + 
+    2 * lengthAdnI * sizeof(int64_t) + 
+    nbRow * sizeof(GASnapshotAdn) + 
+    nbRow * lengthAdnF * 2 * sizeof(float) + 
+    nbRow * lengthAdnI * sizeof(int64_t);
+}
+
+// Return true if the header 'header' of binary snapshot is valid and 
+// describes a snapshot of at most 'size' bytes, else false
+bool GASnapshotCheckHeader(const GASnapshotHeader* const header, 
+  const size_t size) {
+  if (memcmp(header->_magic, GENALG_SNAPSHOT_MAGIC, 
+      sizeof(header->_magic)) != 0 ||
+    header->_version != GENALG_SNAPSHOT_VERSION ||
+    header->_endian != GENALG_SNAPSHOT_ENDIAN ||
+    header->_type < genAlgTypeDefault || 
+    header->_type > genAlgTypeMorpheus ||
+    header->_nbElites < 2 || header->_nbAdns <= header->_nbElites ||
+    header->_lengthAdnF < 0 || header->_lengthAdnI < 0)
+    return false;
+  // Check the dimensions against 'size' before calculating the size 
+  // of the snapshot, to avoid overflows
+  uint64_t nbRow = (uint64_t)header->_nbAdns + 1;
+  if ((uint64_t)header->_lengthAdnF > 
+      size / (nbRow * 2 * sizeof(float)) ||
+    (uint64_t)header->_lengthAdnI > size / (nbRow * sizeof(int64_t)) ||
+    header->_size != GASnapshotGetSize(header) || header->_size > size)
+    return false;
+  return true;
+}
+
+// Return the adn saved in the 'iRow'-th row of the binary snapshot 
+// of the GenAlg 'that', and its sort value in 'elo'
+const GenAlgAdn* GASnapshotGetAdn(const GenAlg* const that, 
+  const long iRow, float* const elo) {
+  // The adns are saved from the head to the tail of the set, then 
+  // the best adn
+  if (iRow < GAGetNbAdns(that)) {
+    GSetElem* elem = that->_ranks[GAGetNbAdns(that) - iRow - 1];
+    if (elo != NULL)
+      *elo = GSetElemGetSortVal(elem);
+    return GSetElemData(elem);
+  } else {
+    if (elo != NULL)
+      *elo = 0.0;
+    return GABestAdn(that);
+  }
+}
+
+// Decode the binary snapshot 'data' of 'size' bytes into the GenAlg 
+// 'that' and set 'sizeSnapshot' to the number of bytes used
+// Return true in case of success, else false
+bool GASnapshotDecode(GenAlg** that, const char* const data, 
+  const size_t size, uint64_t* const sizeSnapshot) {
+  // Check the header
+  if (size < sizeof(GASnapshotHeader))
+    return false;
+  GASnapshotHeader header;
+  memcpy(&header, data, sizeof(GASnapshotHeader));
+  if (GASnapshotCheckHeader(&header, size) == false)
+    return false;
+  uint64_t nbRow = (uint64_t)header._nbAdns + 1;
+  *sizeSnapshot = header._size;
+  // If 'that' is already allocated
+  if (*that != NULL)
+    // Free memory
+    GenAlgFree(that);
+  // Allocate memory
+  long lengthAdnF = header._lengthAdnF;
+  long lengthAdnI = header._lengthAdnI;
+  *that = GenAlgCreate(header._nbAdns, header._nbElites, 
+    lengthAdnF, lengthAdnI);
+  GenAlg* ga = *that;
+  // Set the properties
+  ga->_type = header._type;
+  ga->_NNdata._nbIn = header._nbIn;
+  ga->_NNdata._nbHid = header._nbHid;
+  ga->_NNdata._nbOut = header._nbOut;
+  ga->_NNdata._flagMutableLink = header._flagMutableLink;
+  ga->_NNdata._nbBaseConv = header._nbBaseConv;
+  ga->_NNdata._nbBaseCellConv = header._nbBaseCellConv;
+  ga->_NNdata._nbLink = header._nbLink;
+  ga->_curEpoch = header._curEpoch;
+  ga->_nextId = header._nextId;
+  GASetSeed(ga, header._seed);
+  const char* ptr = data + sizeof(GASnapshotHeader);
+  // Set the bounds
+  if (lengthAdnF > 0) {
+    memcpy(ga->_boundsMinF, ptr, sizeof(float) * lengthAdnF);
+    ptr += sizeof(float) * lengthAdnF;
+    memcpy(ga->_boundsMaxF, ptr, sizeof(float) * lengthAdnF);
+    ptr += sizeof(float) * lengthAdnF;
+    for (long iGene = lengthAdnF; iGene--;) {
+      VecSet(ga->_boundsF + iGene, 0, ga->_boundsMinF[iGene]);
+      VecSet(ga->_boundsF + iGene, 1, ga->_boundsMaxF[iGene]);
+    }
+  }
+  for (long iGene = 0; iGene < lengthAdnI; ++iGene) {
+    int64_t bounds[2];
+    memcpy(bounds, ptr, sizeof(bounds));
+    ptr += sizeof(bounds);
+    VecSet(ga->_boundsI + iGene, 0, bounds[0]);
+    VecSet(ga->_boundsI + iGene, 1, bounds[1]);
+  }
+  GAUpdateNormRange(ga);
+  // Get the sections of the adns
+  const char* recs = ptr;
+  const char* slabF = recs + nbRow * sizeof(GASnapshotAdn);
+  const char* slabDeltaF = slabF + nbRow * lengthAdnF * sizeof(float);
+  const char* slabI = 
+    slabDeltaF + nbRow * lengthAdnF * sizeof(float);
+  // Set the adns
+  for (long iRow = 0; iRow < (long)nbRow; ++iRow) {
+    GenAlgAdn* adn = NULL;
+    GSetElem* elem = NULL;
+    if (iRow < header._nbAdns) {
+      elem = ga->_ranks[header._nbAdns - iRow - 1];
+      adn = GSetElemData(elem);
+    } else {
+      adn = ga->_bestAdn;
+    }
+    GASnapshotAdn rec;
+    memcpy(&rec, recs + iRow * sizeof(GASnapshotAdn), 
+      sizeof(GASnapshotAdn));
+    adn->_id = rec._id;
+    adn->_age = rec._age;
+    adn->_val = rec._val;
+    if (elem != NULL)
+      GSetElemSetSortVal(elem, rec._elo);
+    if (lengthAdnF > 0) {
+      memcpy(adn->_adnF->_val, 
+        slabF + iRow * lengthAdnF * sizeof(float), 
+        sizeof(float) * lengthAdnF);
+      memcpy(adn->_deltaAdnF->_val, 
+        slabDeltaF + iRow * lengthAdnF * sizeof(float), 
+        sizeof(float) * lengthAdnF);
+    }
+    const char* genesI = slabI + iRow * lengthAdnI * sizeof(int64_t);
+    if (sizeof(long) == sizeof(int64_t)) {
+      if (lengthAdnI > 0)
+        memcpy(adn->_adnI->_val, genesI, 
+          sizeof(int64_t) * lengthAdnI);
+    } else {
+      for (long iGene = 0; iGene < lengthAdnI; ++iGene) {
+        int64_t gene;
+        memcpy(&gene, genesI + iGene * sizeof(int64_t), 
+          sizeof(int64_t));
+        VecSet(adn->_adnI, iGene, gene);
+      }
+    }
+  }
+  // Update the rank index
+  GAUpdateRanks(ga);
+  // Return the success code
+  return true;
+}
+
+// Write the id, age, value and sort value of the adns of the GenAlg
+// 'that' in the stream 'stream', as in its binary snapshot
+// Return true in case of success, else false
+bool GASnapshotWriteAdns(const GenAlg* const that, FILE* const stream) {
+  bool ret = true;
+  for (long iRow = 0; ret && iRow <= GAGetNbAdns(that); ++iRow) {
+    GASnapshotAdn rec;
+    memset(&rec, 0, sizeof(GASnapshotAdn));
+    const GenAlgAdn* adn = GASnapshotGetAdn(that, iRow, &(rec._elo));
+    rec._id = adn->_id;
+    rec._age = adn->_age;
+    rec._val = adn->_val;
+    ret = (fwrite(&rec, sizeof(GASnapshotAdn), 1, stream) == 1);
+  }
+  return ret;
+}
+
+// Write the slabs of genes of the 'nb' rows 'iRows' (all the rows if 
+// 'iRows' is null) of the binary snapshot of the GenAlg 'that' in the
+// stream 'stream'
+// Return true in case of success, else false
+bool GASnapshotWriteGenes(const GenAlg* const that, FILE* const stream,
+  const int64_t* const iRows, const long nb) {
+  long lengthAdnF = GAGetLengthAdnFloat(that);
+  long lengthAdnI = GAGetLengthAdnInt(that);
+  bool ret = true;
+  if (lengthAdnF > 0) {
+    for (long i = 0; ret && i < nb; ++i) {
+      const GenAlgAdn* adn = 
+        GASnapshotGetAdn(that, (iRows != NULL ? iRows[i] : i), NULL);
+      ret = (fwrite(GAAdnAdnF(adn)->_val, sizeof(float), lengthAdnF, 
+        stream) == (size_t)lengthAdnF);
+    }
+    for (long i = 0; ret && i < nb; ++i) {
+      const GenAlgAdn* adn = 
+        GASnapshotGetAdn(that, (iRows != NULL ? iRows[i] : i), NULL);
+      ret = (fwrite(GAAdnDeltaAdnF(adn)->_val, sizeof(float), 
+        lengthAdnF, stream) == (size_t)lengthAdnF);
+    }
+  }
+  for (long i = 0; ret && i < nb; ++i) {
+    const GenAlgAdn* adn = 
+      GASnapshotGetAdn(that, (iRows != NULL ? iRows[i] : i), NULL);
+    if (sizeof(long) == sizeof(int64_t)) {
+      ret = (fwrite(GAAdnAdnI(adn)->_val, sizeof(int64_t), lengthAdnI, 
+        stream) == (size_t)lengthAdnI);
+    } else {
+      for (long iGene = 0; ret && iGene < lengthAdnI; ++iGene) {
+        int64_t gene = GAAdnGetGeneI(adn, iGene);
+        ret = (fwrite(&gene, sizeof(int64_t), 1, stream) == 1);
+      }
+    }
+  }
+  return ret;
+}
+
+// Append a checkpoint of the GenAlg 'that' to the stream 'stream'
+// The first checkpoint, and the first one after a call to 
+// GAResetCheckpoint, is a full binary snapshot (cf GASaveBinary). The
+// following ones are deltas which contain the id, age and value of 
+// every adn but the genes of only the adns which were not in the 
+// previous checkpoint
+// Return true in case of success, else false
+bool GASaveCheckpoint(GenAlg* const that, FILE* const stream) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (stream == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'stream' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // In asynchronous mode, save the checkpoint in memory and let the 
+  // writer thread write it
+  if (that->_writer != NULL) {
+    char* data = NULL;
+    size_t size = 0;
+    FILE* mem = open_memstream(&data, &size);
+    bool ret = (mem != NULL && GACheckpointWrite(that, mem));
+    if (mem != NULL)
+      fclose(mem);
+    if (ret)
+      GAIOWriterPush(that->_writer, stream, data, size);
+    else
+      free(data);
+    return ret;
+  }
+  return GACheckpointWrite(that, stream);
+}
+
+// Write the checkpoint of the GenAlg 'that' in the stream 'stream' 
+// (cf GASaveCheckpoint)
+// Return true in case of success, else false
+bool GACheckpointWrite(GenAlg* const that, FILE* const stream) {
+  bool ret = false;
+  // If there is no previous checkpoint, save a full snapshot
+  if (that->_checkpoint._nb == 0) {
+    ret = GASaveBinary(that, stream);
+  } else {
+    // Get the rows whose adn was not in the previous checkpoint, the 
+    // best adn being compared only to the previous best adn
+    long nbRow = GAGetNbAdns(that) + 1;
+    int64_t* iRows = PBErrMalloc(GenAlgErr, sizeof(int64_t) * nbRow);
+    long nbChanged = 0;
+    for (long iRow = 0; iRow < nbRow - 1; ++iRow) {
+      const GenAlgAdn* adn = GASnapshotGetAdn(that, iRow, NULL);
+      if (GACheckpointHasId(&(that->_checkpoint), adn->_id) == false)
+        iRows[nbChanged++] = iRow;
+    }
+    if (GABestAdn(that)->_id != that->_checkpoint._idBest)
+      iRows[nbChanged++] = nbRow - 1;
+    // Create the header
+    GADeltaHeader header;
+    memset(&header, 0, sizeof(GADeltaHeader));
+    memcpy(header._magic, GENALG_DELTA_MAGIC, sizeof(header._magic));
+    header._version = GENALG_SNAPSHOT_VERSION;
+    header._endian = GENALG_SNAPSHOT_ENDIAN;
+    header._nbAdns = GAGetNbAdns(that);
+    header._nbElites = GAGetNbElites(that);
+    header._lengthAdnF = GAGetLengthAdnFloat(that);
+    header._lengthAdnI = GAGetLengthAdnInt(that);
+    header._curEpoch = GAGetCurEpoch(that);
+    header._nextId = that->_nextId;
+    header._seed = GAGetSeed(that);
+    header._nbChanged = nbChanged;
+    header._size = GADeltaGetSize(&header);
+    // Save the delta
+    ret = (fwrite(&header, sizeof(GADeltaHeader), 1, stream) == 1) &&
+      GASnapshotWriteAdns(that, stream) &&
+      (fwrite(iRows, sizeof(int64_t), nbChanged, stream) == 
+        (size_t)nbChanged) &&
+      GASnapshotWriteGenes(that, stream, iRows, nbChanged);
+    free(iRows);
+  }
+  // Memorize the adns of this checkpoint
+  if (ret)
+    GACheckpointMemorize(that);
+  // Return the success code
+  return ret;
+}
+
+// Force the next checkpoint of the GenAlg 'that' to be a full binary
+// snapshot
+// It is automatically called when the genes are reinitialised by 
+// GAInit or the bounds are modified
+void GAResetCheckpoint(GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  that->_checkpoint._nb = 0;
+}
+
+// Load the GenAlg 'that' from the checkpoints in the seekable stream 
+// 'stream', i.e. the full snapshot at the current position and all 
+// the checkpoints after it until the end of the stream
+// The next checkpoint of the loaded GenAlg is a delta, so a run can 
+// be resumed by appending its checkpoints to the same stream
+// If the GenAlg is already allocated, it is freed before loading
+// Return true in case of success, else false
+bool GALoadCheckpoint(GenAlg** that, FILE* const stream) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (stream == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'stream' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // The first checkpoint must be a full snapshot
+  if (GALoadBinary(that, stream) == false)
+    return false;
+  // Apply the following checkpoints until the end of the stream
+  while (true) {
+    char magic[8];
+    size_t nb = fread(magic, 1, sizeof(magic), stream);
+    if (nb == 0 && feof(stream))
+      break;
+    if (nb != sizeof(magic) || fseek(stream, -(long)nb, SEEK_CUR) != 0)
+      return false;
+    if (memcmp(magic, GENALG_SNAPSHOT_MAGIC, sizeof(magic)) == 0) {
+      if (GALoadBinary(that, stream) == false)
+        return false;
+    } else if (memcmp(magic, GENALG_DELTA_MAGIC, sizeof(magic)) == 0) {
+      GADeltaHeader header;
+      if (fread(&header, sizeof(GADeltaHeader), 1, stream) != 1 ||
+        GADeltaCheckHeader(*that, &header, SIZE_MAX) == false)
+        return false;
+      char* data = malloc((size_t)header._size);
+      if (data == NULL)
+        return false;
+      memcpy(data, &header, sizeof(GADeltaHeader));
+      size_t sizeData = sizeof(GADeltaHeader) + 
+        fread(data + sizeof(GADeltaHeader), 1, 
+          (size_t)header._size - sizeof(GADeltaHeader), stream);
+      bool ret = GADeltaDecode(*that, data, sizeData);
+      free(data);
+      if (ret == false)
+        return false;
+    } else {
+      return false;
+    }
+  }
+  GACheckpointMemorize(*that);
+  // Return the success code
+  return true;
+}
+
+// Compact the checkpoints in the stream 'streamIn' into a single full 
+// binary snapshot written to the stream 'streamOut'
+// Return true in case of success, else false
+bool GACompactCheckpoint(FILE* const streamIn, FILE* const streamOut) {
+#if BUILDMODE == 0
+  if (streamIn == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'streamIn' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (streamOut == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'streamOut' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  GenAlg* ga = NULL;
+  bool ret = GALoadCheckpoint(&ga, streamIn) && 
+    GASaveBinary(ga, streamOut);
+  GenAlgFree(&ga);
+  return ret;
+}
+
+// Set the asynchronous I/O flag of the GenAlg 'that'
+// In asynchronous mode GASaveHistory, GASaveCheckpoint and GASaveAsync
+// return as soon as the data to save is copied in memory, and the 
+// data is written by a background thread. The streams given to them 
+// must stay open until GAWaitIO has returned
+// Turning the flag off waits for the pending writes, a failure of 
+// these writes is reported by the next GAWaitIO or GASaveHistory
+void GASetFlagAsyncIO(GenAlg* const that, const bool flag) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  if (flag == true && that->_writer == NULL) {
+    that->_writer = GAIOWriterCreate();
+  } else if (flag == false && that->_writer != NULL) {
+    // Keep the failure of the pending writes for the next GAWaitIO
+    if (GAIOWriterWait(that->_writer) == false) {
+      that->_history._flagError = true;
+      GAResetCheckpoint(that);
+    }
+    GAIOWriterFree(&(that->_writer));
+  }
+  that->_history._writer = that->_writer;
+}
+
+// Wait until all the data saved asynchronously by the GenAlg 'that' 
+// has been written
+// Return true if all the writes since the last call succeeded, false 
+// else, including if the history log couldn't be opened by GAStep
+// As the failed write may be a checkpoint, the next checkpoint after 
+// a failure is a full binary snapshot. The deltas saved between the 
+// failure and the call to GAWaitIO may not be loadable
+bool GAWaitIO(GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  bool ret = !(that->_history._flagError);
+  that->_history._flagError = false;
+  if (that->_writer != NULL) {
+    if (GAIOWriterWait(that->_writer) == false) {
+      ret = false;
+      GAResetCheckpoint(that);
+    }
+    GAIOWriterResetError(that->_writer);
+  }
+  return ret;
+}
+
+// Save the GenAlg 'that' to the stream 'stream' as GASave, from the 
+// background thread if the GenAlg is in asynchronous mode
+// Return true in case of success, else false (in asynchronous mode, 
+// the failure of the write itself is reported by GAWaitIO)
+bool GASaveAsync(GenAlg* const that, FILE* const stream, 
+  const bool compact) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (stream == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'stream' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  if (that->_writer == NULL)
+    return GASave(that, stream, compact);
+  // Encode the GenAlg in memory and let the writer thread write it
+  char* data = NULL;
+  size_t size = 0;
+  FILE* mem = open_memstream(&data, &size);
+  bool ret = (mem != NULL && GASave(that, mem, compact));
+  if (mem != NULL)
+    fclose(mem);
+  if (ret)
+    GAIOWriterPush(that->_writer, stream, data, size);
+  else
+    free(data);
+  return ret;
+}
+
+// Return the size in bytes of the delta checkpoint described by 
+// 'header'
+uint64_t GADeltaGetSize(const GADeltaHeader* const header) {
+  uint64_t nbChanged = (uint64_t)header->_nbChanged;
+  return sizeof(GADeltaHeader) + 
+    ((uint64_t)header->_nbAdns + 1) * sizeof(GASnapshotAdn) + 
+    nbChanged * sizeof(int64_t) +
+    nbChanged * (uint64_t)header->_lengthAdnF * 2 * sizeof(float) + 
+    nbChanged * (uint64_t)header->_lengthAdnI * sizeof(int64_t);
+}
+
+// Return true if the header 'header' of delta checkpoint is valid 
+// for the GenAlg 'that' and describes a delta of at most 'size' 
+// bytes, else false
+bool GADeltaCheckHeader(const GenAlg* const that, 
+  const GADeltaHeader* const header, const size_t size) {
+  if (memcmp(header->_magic, GENALG_DELTA_MAGIC, 
+      sizeof(header->_magic)) != 0 ||
+    header->_version != GENALG_SNAPSHOT_VERSION ||
+    header->_endian != GENALG_SNAPSHOT_ENDIAN ||
+    header->_lengthAdnF != GAGetLengthAdnFloat(that) ||
+    header->_lengthAdnI != GAGetLengthAdnInt(that) ||
+    header->_nbElites < 2 || header->_nbAdns <= header->_nbElites)
+    return false;
+  // Check the dimensions before calculating the size of the delta, 
+  // to avoid overflows
+  long nbRow = header->_nbAdns + 1;
+  if (header->_nbChanged < 0 || header->_nbChanged > nbRow ||
+    header->_size != GADeltaGetSize(header) || header->_size > size)
+    return false;
+  return true;
+}
+
+// Memorize the ids of the adns of the GenAlg 'that' as the ones of 
+// the last checkpoint
+void GACheckpointMemorize(GenAlg* const that) {
+  GACheckpoint* cp = &(that->_checkpoint);
+  long nb = GAGetNbAdns(that);
+  if (nb > cp->_nbMax) {
+    free(cp->_ids);
+    cp->_ids = PBErrMalloc(GenAlgErr, sizeof(unsigned long) * nb);
+    cp->_nbMax = nb;
+  }
+  GSetIterForward iter = GSetIterForwardCreateStatic(GAAdns(that));
+  long iId = 0;
+  do {
+    cp->_ids[iId++] = ((GenAlgAdn*)GSetIterGet(&iter))->_id;
+  } while (GSetIterStep(&iter));
+  qsort(cp->_ids, nb, sizeof(unsigned long), GACmpId);
+  cp->_nb = nb;
+  cp->_idBest = GABestAdn(that)->_id;
+}
+
+// Return true if the id 'id' was in the last checkpoint 'that'
+bool GACheckpointHasId(const GACheckpoint* const that, 
+  const unsigned long id) {
+  return (bsearch(&id, that->_ids, that->_nb, sizeof(unsigned long), 
+    GACmpId) != NULL);
+}
+
+// Comparison function of ids for qsort and bsearch
+int GACmpId(const void* const a, const void* const b) {
+  unsigned long idA = *(const unsigned long*)a;
+  unsigned long idB = *(const unsigned long*)b;
+  return (idA > idB) - (idA < idB);
+}
+
+// Comparison function of GenAlgAdn pointers by id for qsort and 
+// bsearch
+int GACmpAdnId(const void* const a, const void* const b) {
+  return GACmpId(&((*(GenAlgAdn* const*)a)->_id), 
+    &((*(GenAlgAdn* const*)b)->_id));
+}
+
+// Apply the delta checkpoint 'data' of 'size' bytes to the GenAlg 
+// 'that'
+// Return true in case of success, else false
+bool GADeltaDecode(GenAlg* const that, const char* const data, 
+  const size_t size) {
+  // Check the header
+  if (size < sizeof(GADeltaHeader) || that->_store != NULL)
+    return false;
+  GADeltaHeader header;
+  memcpy(&header, data, sizeof(GADeltaHeader));
+  if (GADeltaCheckHeader(that, &header, size) == false)
+    return false;
+  long nbRow = header._nbAdns + 1;
+  long nbChanged = header._nbChanged;
+  // Get the sections
+  long lengthAdnF = header._lengthAdnF;
+  long lengthAdnI = header._lengthAdnI;
+  const char* recs = data + sizeof(GADeltaHeader);
+  const char* rows = recs + nbRow * sizeof(GASnapshotAdn);
+  const char* slabF = rows + nbChanged * sizeof(int64_t);
+  const char* slabDeltaF = slabF + nbChanged * lengthAdnF * sizeof(float);
+  const char* slabI = 
+    slabDeltaF + nbChanged * lengthAdnF * sizeof(float);
+  // Declare the arrays used to rebuild the set of adns
+  long* iChanged = PBErrMalloc(GenAlgErr, sizeof(long) * nbRow);
+  int nbOld = GAGetNbAdns(that);
+  GenAlgAdn** olds = PBErrMalloc(GenAlgErr, sizeof(GenAlgAdn*) * nbOld);
+  bool* isUsed = PBErrMalloc(GenAlgErr, sizeof(bool) * nbOld);
+  GenAlgAdn** adns = 
+    PBErrMalloc(GenAlgErr, sizeof(GenAlgAdn*) * header._nbAdns);
+  bool ret = true;
+  // Get the index in the slabs of each row, -1 if its genes are not 
+  // saved
+  for (long iRow = nbRow; iRow--;)
+    iChanged[iRow] = -1;
+  for (long i = 0; ret && i < nbChanged; ++i) {
+    int64_t iRow;
+    memcpy(&iRow, rows + i * sizeof(int64_t), sizeof(int64_t));
+    if (iRow < 0 || iRow >= nbRow || iChanged[iRow] != -1)
+      ret = false;
+    else
+      iChanged[iRow] = i;
+  }
+  // Get the current adns sorted by id
+  GSetIterForward iter = GSetIterForwardCreateStatic(GAAdns(that));
+  int iOld = 0;
+  do {
+    olds[iOld] = GSetIterGet(&iter);
+    isUsed[iOld] = false;
+    ++iOld;
+  } while (GSetIterStep(&iter));
+  qsort(olds, nbOld, sizeof(GenAlgAdn*), GACmpAdnId);
+  // Find the current adns of the rows whose genes are not saved
+  for (long iRow = 0; ret && iRow < header._nbAdns; ++iRow) {
+    adns[iRow] = NULL;
+    if (iChanged[iRow] == -1) {
+      GASnapshotAdn rec;
+      memcpy(&rec, recs + iRow * sizeof(GASnapshotAdn), 
+        sizeof(GASnapshotAdn));
+      GenAlgAdn key = {._id = rec._id};
+      GenAlgAdn* keyPtr = &key;
+      GenAlgAdn** found = 
+        bsearch(&keyPtr, olds, nbOld, sizeof(GenAlgAdn*), GACmpAdnId);
+      if (found == NULL || isUsed[found - olds]) {
+        ret = false;
+      } else {
+        adns[iRow] = *found;
+        isUsed[found - olds] = true;
+      }
+    }
+  }
+  if (ret && iChanged[nbRow - 1] == -1) {
+    GASnapshotAdn rec;
+    memcpy(&rec, recs + (nbRow - 1) * sizeof(GASnapshotAdn), 
+      sizeof(GASnapshotAdn));
+    ret = (rec._id == that->_bestAdn->_id);
+  }
+  // If the delta is consistent with the GenAlg, apply it
+  if (ret) {
+    // Reuse the adns which are not kept for the rows whose genes are 
+    // saved, and free the remaining ones
+    iOld = 0;
+    for (long iRow = 0; iRow < nbRow; ++iRow) {
+      GenAlgAdn* adn = NULL;
+      if (iRow < header._nbAdns) {
+        if (adns[iRow] == NULL) {
+          while (iOld < nbOld && isUsed[iOld])
+            ++iOld;
+          if (iOld < nbOld) {
+            adns[iRow] = olds[iOld];
+            isUsed[iOld] = true;
+          } else {
+            adns[iRow] = GenAlgAdnCreate(0, lengthAdnF, lengthAdnI);
+          }
+        }
+        adn = adns[iRow];
+      } else {
+        adn = that->_bestAdn;
+      }
+      GASnapshotAdn rec;
+      memcpy(&rec, recs + iRow * sizeof(GASnapshotAdn), 
+        sizeof(GASnapshotAdn));
+      adn->_id = rec._id;
+      adn->_age = rec._age;
+      adn->_val = rec._val;
+      adn->_flagCachedVal = false;
+      adn->_flagPartialVal = false;
+      long i = iChanged[iRow];
+      if (i != -1) {
+        if (lengthAdnF > 0) {
+          memcpy(adn->_adnF->_val, 
+            slabF + i * lengthAdnF * sizeof(float), 
+            sizeof(float) * lengthAdnF);
+          memcpy(adn->_deltaAdnF->_val, 
+            slabDeltaF + i * lengthAdnF * sizeof(float), 
+            sizeof(float) * lengthAdnF);
+        }
+        const char* genesI = slabI + i * lengthAdnI * sizeof(int64_t);
+        for (long iGene = 0; iGene < lengthAdnI; ++iGene) {
+          int64_t gene;
+          memcpy(&gene, genesI + iGene * sizeof(int64_t), 
+            sizeof(int64_t));
+          VecSet(adn->_adnI, iGene, gene);
+        }
+      }
+    }
+    for (iOld = 0; iOld < nbOld; ++iOld)
+      if (isUsed[iOld] == false)
+        GenAlgAdnFree(olds + iOld);
+    // Resize the set and put the adns in it, from the head to the 
+    // tail
+    GSet* set = GAAdns(that);
+    while (GSetNbElem(set) > header._nbAdns)
+      GSetPop(set);
+    while (GSetNbElem(set) < header._nbAdns)
+      GSetPush(set, NULL);
+    iter = GSetIterForwardCreateStatic(set);
+    long iRow = 0;
+    do {
+      GSetElem* elem = GSetIterGetElem(&iter);
+      GASnapshotAdn rec;
+      memcpy(&rec, recs + iRow * sizeof(GASnapshotAdn), 
+        sizeof(GASnapshotAdn));
+      elem->_data = adns[iRow];
+      GSetElemSetSortVal(elem, rec._elo);
+      ++iRow;
+    } while (GSetIterStep(&iter));
+    // Set the properties
+    that->_nbElites = header._nbElites;
+    that->_curEpoch = header._curEpoch;
+    that->_nextId = header._nextId;
+    if (header._seed != GAGetSeed(that))
+      GASetSeed(that, header._seed);
+    GAUpdateRanks(that);
+  }
+  // Free memory
+  free(iChanged);
+  free(olds);
+  free(isUsed);
+  free(adns);
+  // Return the success code
+  return ret;
+}
+
+// Set the flag memorizing if the TextOMeter is displayed for
 // the GenAlg 'that' to 'flag'
 void GASetTextOMeterFlag(GenAlg* const that, bool flag) {
 #if BUILDMODE == 0
@@ -2087,112 +5181,1750 @@ void GASetTextOMeterFlag(GenAlg* const that, bool flag) {
     PBErrCatch(GenAlgErr);
   }
 #endif
-  // If the requested flag is different from the current flag;
-  if (that->_flagTextOMeter != flag) {
-    if (flag && that->_textOMeter == NULL) {
-      char title[] = "GenAlg";
-      int width = strlen(GENALG_TXTOMETER_LINE1) + 1;
-      int height = 10 + 
-        MIN(GENALG_TXTOMETER_NBADNDISPLAYED, GAGetNbMaxAdn(that));
-      that->_textOMeter = TextOMeterCreate(title, width, height);
+  // If the requested flag is different from the current flag;
+  if (that->_flagTextOMeter != flag) {
+    if (flag && that->_textOMeter == NULL) {
+      char title[] = "GenAlg";
+      int width = strlen(GENALG_TXTOMETER_LINE1) + 1;
+      int height = 10 + 
+        MIN(GENALG_TXTOMETER_NBADNDISPLAYED, GAGetNbMaxAdn(that));
+      that->_textOMeter = TextOMeterCreate(title, width, height);
+    }
+    if (!flag && that->_textOMeter != NULL) {
+      TextOMeterFree(&(that->_textOMeter));
+    }
+    that->_flagTextOMeter = flag;
+  }
+}
+
+// Refresh the content of the TextOMeter attached to the GenAlg 'that'
+void GAUpdateTextOMeter(const GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (that->_textOMeter == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that->_textOMeter' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // Clear the TextOMeter
+  TextOMeterClear(that->_textOMeter);
+  // Declare a variable to print the content of the TextOMeter
+  char str[50];
+  // Print the content of the TextOMeter
+  // Epoch #xxxxxx  KTEvent #xxxxxx
+  sprintf(str, GENALG_TXTOMETER_FORMAT1, 
+    GAGetCurEpoch(that), GAGetNbKTEvent(that));
+  TextOMeterPrint(that->_textOMeter, str);
+  // Diversity +xxxxxx.xxxxxx
+  sprintf(str, GENALG_TXTOMETER_FORMAT5, GAGetDiversity(that), 
+    GAGetDiversityThreshold(that));
+  TextOMeterPrint(that->_textOMeter, str);
+  // Nb adns xxxxxx
+  sprintf(str, GENALG_TXTOMETER_FORMAT6, GAGetNbAdns(that));
+  TextOMeterPrint(that->_textOMeter, str);
+  //
+  sprintf(str, "\n");
+  TextOMeterPrint(that->_textOMeter, str);
+  // Id      Age     Val
+  sprintf(str, GENALG_TXTOMETER_LINE2);
+  TextOMeterPrint(that->_textOMeter, str);
+  // xxxxxx  xxxxxx  +xxxxxx.xxxx
+  sprintf(str, GENALG_TXTOMETER_FORMAT3, 
+    GAAdnGetId(GABestAdn(that)), GAAdnGetAge(GABestAdn(that)),
+    GAAdnGetVal(GABestAdn(that)));
+  TextOMeterPrint(that->_textOMeter, str);
+  // .........................
+  sprintf(str, GENALG_TXTOMETER_LINE4);
+  TextOMeterPrint(that->_textOMeter, str);
+  // xxxxxx  xxxxxx  +xxxxxx.xxxx
+  for (int iRank = 0; iRank < GAGetNbElites(that); ++iRank) {
+    sprintf(str, GENALG_TXTOMETER_FORMAT3, 
+      GAAdnGetId(GAAdn(that, iRank)), GAAdnGetAge(GAAdn(that, iRank)),
+      GAAdnGetVal(GAAdn(that, iRank)));
+    TextOMeterPrint(that->_textOMeter, str);
+  }
+  // .........................
+  sprintf(str, GENALG_TXTOMETER_LINE4);
+  TextOMeterPrint(that->_textOMeter, str);
+  // xxxxxx  xxxxxx  +xxxxxx.xxxx
+  int maxRank = MIN(GENALG_TXTOMETER_NBADNDISPLAYED, GAGetNbAdns(that));
+  for (int iRank = GAGetNbElites(that); iRank < maxRank; ++iRank) {
+    sprintf(str, GENALG_TXTOMETER_FORMAT3, 
+      GAAdnGetId(GAAdn(that, iRank)), GAAdnGetAge(GAAdn(that, iRank)),
+      GAAdnGetVal(GAAdn(that, iRank)));
+    TextOMeterPrint(that->_textOMeter, str);
+  }
+  // Fill in with blank lines if necessary
+  sprintf(str, "\n");
+  for (int iBlank = GAGetNbAdns(that); 
+    iBlank < GENALG_TXTOMETER_NBADNDISPLAYED; ++iBlank) {
+    TextOMeterPrint(that->_textOMeter, str);
+  }
+  // If there are more adns than availalbe space in the TextOMeter
+  if (GAGetNbAdns(that)> GENALG_TXTOMETER_NBADNDISPLAYED) {
+    sprintf(str, "...");
+    TextOMeterPrint(that->_textOMeter, str);
+  }
+  // Flush the content of the TextOMeter
+  TextOMeterFlush(that->_textOMeter);
+}
+  
+// Create a static GAHistory
+GAHistory GAHistoryCreateStatic(void) {
+  // Declare the new GAHistory
+  GAHistory that;
+  // Init properties
+  that._genealogy = NULL;
+  that._lastChunk = NULL;
+  that._nbBirth = 0;
+  // The default path of the log, formerly ./genAlgHistory.json when 
+  // the history was saved in JSON
+  that._path = strdup("./genAlgHistory.bin");
+  that._births = NULL;
+  that._nbMaxPending = 0;
+  that._iFirst = 0;
+  that._nbPending = 0;
+  that._flagError = false;
+  that._log = NULL;
+  that._writer = NULL;
+  that._index = NULL;
+  // Return the new GAHistory
+  return that;
+}
+
+// Free the memory used by the GAHistory 'that'
+void GAHistoryFree(GAHistory* that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // Append the pending births to the log before closing it
+  if (that->_nbPending > 0)
+    GAHistoryWrite(that);
+  // Flush the history
+  GAHistoryFlush(that);
+  // Free memory
+  GAGenealogyFree(&(that->_index));
+  free(that->_genealogy);
+  free(that->_path);
+  free(that->_births);
+}
+
+// Flush the content of the GAHistory 'that'
+void GAHistoryFlush(GAHistory* that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // Release the chunks of the genealogy but the first one
+  if (that->_genealogy != NULL) {
+    GAHistoryChunk* chunk = that->_genealogy->_next;
+    while (chunk != NULL) {
+      GAHistoryChunk* next = chunk->_next;
+      free(chunk);
+      chunk = next;
+    }
+    that->_genealogy->_next = NULL;
+    that->_genealogy->_nb = 0;
+  }
+  that->_lastChunk = that->_genealogy;
+  that->_nbBirth = 0;
+  if (that->_index != NULL)
+    GAGenealogyFlush(that->_index);
+  // Discard the pending births and close the log, the next write 
+  // will recreate it
+  that->_iFirst = 0;
+  that->_nbPending = 0;
+  that->_flagError = false;
+  if (that->_log != NULL) {
+    if (that->_writer != NULL)
+      GAIOWriterWait(that->_writer);
+    fclose(that->_log);
+    that->_log = NULL;
+  }
+}
+
+// Save the history of the GenAlg 'that', i.e. append the births 
+// recorded since the last save to its binary genealogy log
+// The log is recreated by the first save after GAInit
+// Return true if we could save the history, false else, including if
+// the log couldn't be written by GAStep since the last call (the 
+// births are then kept until they can be written)
+bool GASaveHistory(GenAlg* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // Append the pending births to the log
+  bool ret = GAHistoryWrite(&(that->_history));
+  // Report and reset the error of the writes done by GAStep
+  if (that->_history._flagError) {
+    ret = false;
+    that->_history._flagError = false;
+  }
+  return ret;
+}
+
+// Append the pending births of the GAHistory 'that' to its binary 
+// genealogy log
+// Return true if we could write the births, false else
+bool GAHistoryWrite(GAHistory* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // In asynchronous mode, copy the pending births and let the writer
+  // thread write them
+  if (that->_writer != NULL)
+    return GAHistoryPush(that);
+  // If the log is not opened yet, create it with its header
+  if (that->_log == NULL) {
+    that->_log = fopen(that->_path, "wb");
+    if (that->_log == NULL)
+      return false;
+    GAHistoryLogHeader header;
+    memset(&header, 0, sizeof(GAHistoryLogHeader));
+    memcpy(header._magic, GENALG_HISTORY_MAGIC, sizeof(header._magic));
+    header._version = GENALG_HISTORY_VERSION;
+    header._endian = GENALG_SNAPSHOT_ENDIAN;
+    if (fwrite(&header, sizeof(GAHistoryLogHeader), 1, 
+      that->_log) != 1) {
+      // Recreate the log at the next write
+      fclose(that->_log);
+      that->_log = NULL;
+      return false;
+    }
+  }
+  // Write the pending births in at most two contiguous chunks of the 
+  // ring buffer
+  bool ret = true;
+  while (ret && that->_nbPending > 0) {
+    long nb = that->_nbMaxPending - that->_iFirst;
+    if (nb > that->_nbPending)
+      nb = that->_nbPending;
+    const GAHistoryBirth* births = that->_births + that->_iFirst;
+    long nbWritten = 0;
+    if (sizeof(GAHistoryBirth) == 4 * sizeof(uint64_t)) {
+      nbWritten = 
+        (long)fwrite(births, sizeof(GAHistoryBirth), nb, that->_log);
+    } else {
+      for (; nbWritten < nb; ++nbWritten) {
+        uint64_t rec[4] = {births[nbWritten]._epoch, 
+          births[nbWritten]._idParents[0], 
+          births[nbWritten]._idParents[1], births[nbWritten]._idChild};
+        if (fwrite(rec, sizeof(rec), 1, that->_log) != 1)
+          break;
+      }
+    }
+    // Remove the births written from the pending ones even if the 
+    // write failed, to not duplicate them in the log when retrying
+    that->_iFirst = (that->_iFirst + nbWritten) % that->_nbMaxPending;
+    that->_nbPending -= nbWritten;
+    ret = (nbWritten == nb);
+  }
+  // Make the log readable up to the last birth
+  ret = ret && (fflush(that->_log) == 0);
+  GAHistoryShrink(that);
+  // Return the success code
+  return ret;
+}
+
+
+// Function which return the JSON encoding of the GAHistory 'that' 
+JSONNode* GAHistoryEncodeAsJSON(const GAHistory* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Create the JSON structure
+  JSONNode* json = JSONCreate();
+  // Declare a buffer to convert value into string
+  char val[100];
+
+  // Array of birth
+  JSONArrayStruct genealogy = JSONArrayStructCreateStatic();
+  // Loop on the births
+  for (const GAHistoryChunk* chunk = that->_genealogy; chunk != NULL;
+    chunk = chunk->_next) {
+    for (long iBirth = 0; iBirth < chunk->_nb; ++iBirth) {
+      // Get the birth
+      const GAHistoryBirth* birth = chunk->_births + iBirth;
+      // Encode the birth
+      JSONNode* birthJson = JSONCreate();
+      sprintf(val, "%ld", birth->_epoch);
+      JSONAddProp(birthJson, "_epoch", val);
+      sprintf(val, "%ld", birth->_idParents[0]);
+      JSONAddProp(birthJson, "_father", val);
+      sprintf(val, "%ld", birth->_idParents[1]);
+      JSONAddProp(birthJson, "_mother", val);
+      sprintf(val, "%ld", birth->_idChild);
+      JSONAddProp(birthJson, "_id", val);
+      // Add the birth to the array
+      JSONArrayStructAdd(&genealogy, birthJson);
+    }
+  }
+  // Add the genealogy
+  JSONAddProp(json, "_genealogy", &genealogy);
+  // Flush the temporary node for the genealogy
+  JSONArrayStructFlush(&genealogy);
+  // Return the created JSON 
+  return json;
+}
+
+// Load the history into the GAHistory 'that' from the FILE 'stream'
+// Return true if we could load the history, false else
+bool GAHistoryLoad(GAHistory* const that, FILE* const stream) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (stream == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'stream' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // If the stream is a binary genealogy log, its magic starts with 
+  // 'G' while the JSON encoding starts with '{'. Peek only one 
+  // character so that non seekable streams can be loaded
+  int c = getc(stream);
+  if (c != EOF && ungetc(c, stream) == EOF)
+    return false;
+  if (c == GENALG_HISTORY_MAGIC[0]) {
+    GAHistoryFlush(that);
+    if (GAHistoryReadLogHeader(stream) == false)
+      return false;
+    // Decode the births by batches
+    GAHistoryBirth* births = 
+      PBErrMalloc(GenAlgErr, sizeof(GAHistoryBirth) * 
+        GENALG_HISTORY_BUFFER);
+    long nb = 0;
+    do {
+      nb = GAHistoryReadLog(stream, births, GENALG_HISTORY_BUFFER);
+      for (long iBirth = 0; iBirth < nb; ++iBirth)
+        GAHistoryAddBirth(that, births[iBirth]._epoch, 
+          births[iBirth]._idParents[0], births[iBirth]._idParents[1], 
+          births[iBirth]._idChild);
+    } while (nb == GENALG_HISTORY_BUFFER);
+    free(births);
+    return (nb != -1);
+  }
+  // Declare a json to load the encoded data
+  JSONNode* json = JSONCreate();
+  // Load the whole encoded data
+  if (!JSONLoad(json, stream)) {
+    return false;
+  }
+  // Decode the data from the JSON
+  if (!GAHistoryDecodeAsJSON(that, json)) {
+    return false;
+  }
+  // Free the memory used by the JSON
+  JSONFree(&json);
+  // Return the success code
+  return true;
+}
+
+// Function which decode from JSON encoding 'json' to GAHistory 'that'
+bool GAHistoryDecodeAsJSON(GAHistory* const that,
+  const JSONNode* const json) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'that' is null");
+    PBErrCatch(PBMathErr);
+  }
+  if (json == NULL) {
+    PBMathErr->_type = PBErrTypeNullPointer;
+    sprintf(PBMathErr->_msg, "'json' is null");
+    PBErrCatch(PBMathErr);
+  }
+#endif
+  // Flush the history
+  GAHistoryFlush(that);
+  // Decode the genealogy
+  JSONNode* propGen = JSONProperty(json, "_genealogy");
+  if (propGen == NULL) {
+    return false;
+  }
+  // Loop on the births
+  for (int i = 0; i < JSONGetNbValue(propGen); ++i) {
+    JSONNode* val = JSONValue(propGen, i);
+    // Decode the epoch
+    JSONNode* prop = JSONProperty(val, "_epoch");
+    if (prop == NULL) {
+      return false;
+    }
+    long epoch = atol(JSONLblVal(prop));
+    // Decode the father
+    prop = JSONProperty(val, "_father");
+    if (prop == NULL) {
+      return false;
+    }
+    long father = atol(JSONLblVal(prop));
+    // Decode the epoch
+    prop = JSONProperty(val, "_mother");
+    if (prop == NULL) {
+      return false;
+    }
+    long mother = atol(JSONLblVal(prop));
+    // Decode the id
+    prop = JSONProperty(val, "_id");
+    if (prop == NULL) {
+      return false;
+    }
+    long id = atol(JSONLblVal(prop));
+    // Add the birth to history
+    GAHistoryAddBirth(that, epoch, father, mother, id);
+  }
+  // Return the success code
+  return true;
+}
+
+// Convert the binary genealogy log 'streamLog' into its JSON encoding 
+// (the same as GAHistoryEncodeAsJSON) in the stream 'streamJSON'
+// The births are converted one at a time, the log is never entirely 
+// loaded in memory
+// Return true if we could convert the history, false else
+bool GAHistoryConvertToJSON(FILE* const streamLog, 
+  FILE* const streamJSON, const bool compact) {
+#if BUILDMODE == 0
+  if (streamLog == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'streamLog' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (streamJSON == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'streamJSON' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  if (GAHistoryReadLogHeader(streamLog) == false)
+    return false;
+  GAJSONStream json = {._stream = streamJSON, ._compact = compact, 
+    ._depth = -1};
+  // Declare a buffer to convert value into string
+  char val[100];
+  GAJSONStreamOpen(&json, '{');
+  GAJSONStreamKey(&json, "_genealogy");
+  GAJSONStreamOpen(&json, '[');
+  // Loop on the births
+  GAHistoryBirth birth;
+  long nb = 0;
+  while ((nb = GAHistoryReadLog(streamLog, &birth, 1)) == 1) {
+    GAJSONStreamNext(&json);
+    GAJSONStreamOpen(&json, '{');
+    sprintf(val, "%ld", birth._epoch);
+    GAJSONStreamProp(&json, "_epoch", val);
+    sprintf(val, "%ld", birth._idParents[0]);
+    GAJSONStreamProp(&json, "_father", val);
+    sprintf(val, "%ld", birth._idParents[1]);
+    GAJSONStreamProp(&json, "_mother", val);
+    sprintf(val, "%ld", birth._idChild);
+    GAJSONStreamProp(&json, "_id", val);
+    GAJSONStreamClose(&json, '}');
+  }
+  GAJSONStreamClose(&json, ']');
+  GAJSONStreamClose(&json, '}');
+  fprintf(streamJSON, "\n");
+  // Return the success code
+  return (nb == 0 && ferror(streamJSON) == 0);
+}
+
+// Set the flag indexing the births of the GAHistory 'that'
+// When it's set, the births loaded so far are indexed, and the next 
+// births recorded or loaded are indexed as they come
+void GAHistorySetFlagIndex(GAHistory* const that, const bool flag) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  if (flag == false) {
+    GAGenealogyFree(&(that->_index));
+  } else if (that->_index == NULL) {
+    that->_index = GAGenealogyCreate();
+    for (const GAHistoryChunk* chunk = that->_genealogy; chunk != NULL;
+      chunk = chunk->_next) {
+      for (long iBirth = 0; iBirth < chunk->_nb; ++iBirth)
+        GAGenealogyAdd(that->_index, chunk->_births + iBirth);
+    }
+  }
+}
+
+// Double the size of the ring buffer of pending births of the 
+// GAHistory 'that', keeping its births
+void GAHistoryGrow(GAHistory* const that) {
+  long nbMax = 2 * that->_nbMaxPending;
+  GAHistoryBirth* births = 
+    PBErrMalloc(GenAlgErr, sizeof(GAHistoryBirth) * nbMax);
+  // Unroll the pending births at the beginning of the new buffer
+  for (long iBirth = 0; iBirth < that->_nbPending; ++iBirth)
+    births[iBirth] = that->_births[
+      (that->_iFirst + iBirth) % that->_nbMaxPending];
+  free(that->_births);
+  that->_births = births;
+  that->_nbMaxPending = nbMax;
+  that->_iFirst = 0;
+}
+
+// Copy the pending births of the GAHistory 'that' (preceded by the 
+// header of the log if it's not created yet) and queue them to its 
+// writer
+// Return true if the log could be opened, false else
+bool GAHistoryPush(GAHistory* const that) {
+  size_t sizeHeader = 0;
+  if (that->_log == NULL) {
+    that->_log = fopen(that->_path, "wb");
+    if (that->_log == NULL)
+      return false;
+    sizeHeader = sizeof(GAHistoryLogHeader);
+  }
+  size_t size = sizeHeader + that->_nbPending * 4 * sizeof(uint64_t);
+  if (size == 0)
+    return true;
+  char* data = PBErrMalloc(GenAlgErr, size);
+  if (sizeHeader > 0) {
+    GAHistoryLogHeader header;
+    memset(&header, 0, sizeof(GAHistoryLogHeader));
+    memcpy(header._magic, GENALG_HISTORY_MAGIC, sizeof(header._magic));
+    header._version = GENALG_HISTORY_VERSION;
+    header._endian = GENALG_SNAPSHOT_ENDIAN;
+    memcpy(data, &header, sizeof(GAHistoryLogHeader));
+  }
+  uint64_t* rec = (uint64_t*)(data + sizeHeader);
+  for (long iBirth = 0; iBirth < that->_nbPending; ++iBirth) {
+    const GAHistoryBirth* birth = that->_births + 
+      (that->_iFirst + iBirth) % that->_nbMaxPending;
+    *(rec++) = birth->_epoch;
+    *(rec++) = birth->_idParents[0];
+    *(rec++) = birth->_idParents[1];
+    *(rec++) = birth->_idChild;
+  }
+  that->_iFirst = 0;
+  that->_nbPending = 0;
+  GAHistoryShrink(that);
+  GAIOWriterPush(that->_writer, that->_log, data, size);
+  return true;
+}
+
+// Release the ring buffer of pending births of the GAHistory 'that' 
+// if it's empty and has grown, it's reallocated at the next birth
+void GAHistoryShrink(GAHistory* const that) {
+  if (that->_nbPending == 0 && 
+    that->_nbMaxPending > GENALG_HISTORY_BUFFER) {
+    free(that->_births);
+    that->_births = NULL;
+    that->_nbMaxPending = 0;
+    that->_iFirst = 0;
+  }
+}
+
+// Add the birth of 'idChild' from 'idFather' and 'idMother' at epoch 
+// 'epoch' to the genealogy of the GAHistory 'that'
+void GAHistoryAddBirth(GAHistory* const that, const unsigned long epoch,
+  const unsigned long idFather, const unsigned long idMother, 
+  const unsigned long idChild) {
+  // If the last chunk is full, add a new one
+  if (that->_lastChunk == NULL || 
+    that->_lastChunk->_nb == GENALG_HISTORY_CHUNK) {
+    GAHistoryChunk* chunk = PBErrMalloc(GenAlgErr, 
+      sizeof(GAHistoryChunk) + 
+      sizeof(GAHistoryBirth) * GENALG_HISTORY_CHUNK);
+    chunk->_next = NULL;
+    chunk->_nb = 0;
+    if (that->_lastChunk == NULL)
+      that->_genealogy = chunk;
+    else
+      that->_lastChunk->_next = chunk;
+    that->_lastChunk = chunk;
+  }
+  // Bump allocate the birth in the last chunk
+  GAHistoryBirth* birth = 
+    that->_lastChunk->_births + (that->_lastChunk->_nb)++;
+  birth->_epoch = epoch;
+  birth->_idParents[0] = idFather;
+  birth->_idParents[1] = idMother;
+  birth->_idChild = idChild;
+  ++(that->_nbBirth);
+  if (that->_index != NULL)
+    GAGenealogyAdd(that->_index, birth);
+}
+
+// Get the 'iBirth'-th birth in the genealogy of the GAHistory 'that'
+const GAHistoryBirth* GAHistoryGetBirth(const GAHistory* const that, 
+  const long iBirth) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (iBirth < 0 || iBirth >= that->_nbBirth) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'iBirth' is invalid (0<=%ld<%ld)", 
+      iBirth, that->_nbBirth);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // All the chunks but the last one are full
+  const GAHistoryChunk* chunk = that->_genealogy;
+  for (long iChunk = iBirth / GENALG_HISTORY_CHUNK; iChunk--;)
+    chunk = chunk->_next;
+  return chunk->_births + iBirth % GENALG_HISTORY_CHUNK;
+}
+
+// Read and check the header of the binary genealogy log 'stream'
+// Return true if the header is valid, else false
+bool GAHistoryReadLogHeader(FILE* const stream) {
+  GAHistoryLogHeader header;
+  return (fread(&header, sizeof(GAHistoryLogHeader), 1, stream) == 1 &&
+    memcmp(header._magic, GENALG_HISTORY_MAGIC, 
+      sizeof(header._magic)) == 0 &&
+    header._version == GENALG_HISTORY_VERSION &&
+    header._endian == GENALG_SNAPSHOT_ENDIAN);
+}
+
+// Read at most 'nb' births from the binary genealogy log 'stream' 
+// into 'births'
+// Return the number of births read, or -1 if the log is truncated
+long GAHistoryReadLog(FILE* const stream, GAHistoryBirth* const births,
+  const long nb) {
+  long nbRead = 0;
+  if (sizeof(GAHistoryBirth) == 4 * sizeof(uint64_t)) {
+    size_t size = fread(births, 1, sizeof(GAHistoryBirth) * nb, stream);
+    if (size % sizeof(GAHistoryBirth) != 0)
+      return -1;
+    nbRead = size / sizeof(GAHistoryBirth);
+  } else {
+    uint64_t rec[4];
+    size_t size = 0;
+    while (nbRead < nb && 
+      (size = fread(rec, 1, sizeof(rec), stream)) == sizeof(rec)) {
+      births[nbRead]._epoch = rec[0];
+      births[nbRead]._idParents[0] = rec[1];
+      births[nbRead]._idParents[1] = rec[2];
+      births[nbRead]._idChild = rec[3];
+      ++nbRead;
+    }
+    if (nbRead < nb && size != 0)
+      return -1;
+  }
+  return nbRead;
+}
+
+// Create a new empty GAAdnStore for adns of length 'lengthAdnF' and 
+// 'lengthAdnI'
+GAAdnStore* GAAdnStoreCreate(const long lengthAdnF, 
+  const long lengthAdnI) {
+  // Allocate memory
+  GAAdnStore* that = PBErrMalloc(GenAlgErr, sizeof(GAAdnStore));
+  // Calculate the size of the rows, rounded up to the alignment so 
+  // that each row starts on its own cache line
+  size_t align = GENALG_STORE_ALIGN;
+  that->_strideF = 0;
+  if (lengthAdnF > 0)
+    that->_strideF = ((sizeof(VecFloat) + 
+      sizeof(float) * lengthAdnF + align - 1) / align) * align;
+  that->_strideI = 0;
+  that->_strideMutI = 0;
+  if (lengthAdnI > 0) {
+    that->_strideI = ((sizeof(VecLong) + 
+      sizeof(long) * lengthAdnI + align - 1) / align) * align;
+    that->_strideMutI = ((sizeof(VecFloat) + 
+      sizeof(float) * lengthAdnI + align - 1) / align) * align;
+  }
+  // Set the properties, the slabs are allocated by GAAdnStoreReserve
+  that->_adnF = NULL;
+  that->_deltaAdnF = NULL;
+  that->_mutabilityF = NULL;
+  that->_adnI = NULL;
+  that->_mutabilityI = NULL;
+  that->_nbRow = 0;
+  that->_freeRows = NULL;
+  that->_nbFreeRow = 0;
+  // Return the new GAAdnStore
+  return that;
+}
+
+// Free the memory used by the GAAdnStore 'that'
+void GAAdnStoreFree(GAAdnStore** that) {
+  // Check the argument
+  if (that == NULL || *that == NULL) return;
+  // Free memory
+  free((*that)->_adnF);
+  free((*that)->_deltaAdnF);
+  free((*that)->_mutabilityF);
+  free((*that)->_adnI);
+  free((*that)->_mutabilityI);
+  free((*that)->_freeRows);
+  free(*that);
+  // Set the pointer to null
+  *that = NULL;
+}
+
+// Reallocate the slab 'slab' of 'nbRow' rows of 'stride' bytes to
+// 'nbRowNew' rows
+char* GAAdnStoreSlabResize(char* const slab, const size_t stride, 
+  const long nbRow, const long nbRowNew) {
+  // If there is no gene in this slab, nothing to do
+  if (stride == 0)
+    return NULL;
+  // Allocate the new slab
+  char* newSlab = aligned_alloc(GENALG_STORE_ALIGN, 
+    stride * (size_t)nbRowNew);
+  if (newSlab == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "aligned_alloc failed (%ld rows)", 
+      nbRowNew);
+    PBErrCatch(GenAlgErr);
+  }
+  // Copy the current rows and reset the new ones
+  if (slab != NULL)
+    memcpy(newSlab, slab, stride * (size_t)nbRow);
+  memset(newSlab + stride * (size_t)nbRow, 0, 
+    stride * (size_t)(nbRowNew - nbRow));
+  // Free the old slab
+  free(slab);
+  // Return the new slab
+  return newSlab;
+}
+
+// Ensure the store of the GenAlg 'that' has at least 'nbRow' rows
+// The views of the adns currently in the store are updated if the 
+// slabs are moved
+void GAAdnStoreReserve(GenAlg* const that, const long nbRow) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (that->_store == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that->_store' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  GAAdnStore* store = that->_store;
+  // If there are already enough rows, nothing to do
+  if (store->_nbRow >= nbRow)
+    return;
+  // Grow at least geometrically to amortize the copies
+  long nbRowNew = MAX(nbRow, 2 * store->_nbRow);
+  // Resize the slabs
+  store->_adnF = GAAdnStoreSlabResize(store->_adnF, store->_strideF,
+    store->_nbRow, nbRowNew);
+  store->_deltaAdnF = GAAdnStoreSlabResize(store->_deltaAdnF, 
+    store->_strideF, store->_nbRow, nbRowNew);
+  store->_mutabilityF = GAAdnStoreSlabResize(store->_mutabilityF, 
+    store->_strideF, store->_nbRow, nbRowNew);
+  store->_adnI = GAAdnStoreSlabResize(store->_adnI, store->_strideI,
+    store->_nbRow, nbRowNew);
+  store->_mutabilityI = GAAdnStoreSlabResize(store->_mutabilityI, 
+    store->_strideMutI, store->_nbRow, nbRowNew);
+  // Add the new rows to the stack of free rows, in decreasing order
+  // so that rows are used in increasing order
+  store->_freeRows = realloc(store->_freeRows, 
+    sizeof(long) * nbRowNew);
+  if (store->_freeRows == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "realloc failed");
+    PBErrCatch(GenAlgErr);
+  }
+  for (long iRow = nbRowNew; iRow-- > store->_nbRow;) {
+    store->_freeRows[store->_nbFreeRow] = iRow;
+    ++(store->_nbFreeRow);
+  }
+  store->_nbRow = nbRowNew;
+  // Update the views of the adns in the store
+  if (GSetNbElem(GAAdns(that)) > 0) {
+    GSetIterForward iter = GSetIterForwardCreateStatic(GAAdns(that));
+    do {
+      GenAlgAdn* adn = GSetIterGet(&iter);
+      if (adn->_iRow >= 0)
+        GAAdnStorePoint(store, adn);
+    } while (GSetIterStep(&iter));
+  }
+}
+
+// Point the vectors of the GenAlgAdn 'adn' to its row in the 
+// GAAdnStore 'that'
+void GAAdnStorePoint(const GAAdnStore* const that, 
+  GenAlgAdn* const adn) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (adn == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'adn' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (adn->_iRow < 0 || adn->_iRow >= that->_nbRow) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'adn->_iRow' is invalid (0<=%ld<%ld)",
+      adn->_iRow, that->_nbRow);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  size_t iRow = (size_t)(adn->_iRow);
+  if (that->_strideF > 0) {
+    adn->_adnF = (VecFloat*)(that->_adnF + iRow * that->_strideF);
+    adn->_deltaAdnF = 
+      (VecFloat*)(that->_deltaAdnF + iRow * that->_strideF);
+    adn->_mutabilityF = 
+      (VecFloat*)(that->_mutabilityF + iRow * that->_strideF);
+  }
+  if (that->_strideI > 0) {
+    adn->_adnI = (VecLong*)(that->_adnI + iRow * that->_strideI);
+    adn->_mutabilityI = 
+      (VecFloat*)(that->_mutabilityI + iRow * that->_strideMutI);
+  }
+}
+
+// Move the genes of the GenAlgAdn 'adn' into a row of the store of 
+// the GenAlg 'that', the previous vectors of 'adn' are freed
+void GAAdnStoreAttach(GenAlg* const that, GenAlgAdn* const adn) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (adn == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'adn' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (adn->_iRow >= 0) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'adn' is already in a store");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  GAAdnStore* store = that->_store;
+  // Ensure there is a free row
+  if (store->_nbFreeRow == 0)
+    GAAdnStoreReserve(that, store->_nbRow + 1);
+  // Memorize the current vectors
+  VecFloat* adnF = adn->_adnF;
+  VecFloat* deltaAdnF = adn->_deltaAdnF;
+  VecFloat* mutabilityF = adn->_mutabilityF;
+  VecLong* adnI = adn->_adnI;
+  VecFloat* mutabilityI = adn->_mutabilityI;
+  // Take a free row and point the vectors into it
+  --(store->_nbFreeRow);
+  adn->_iRow = store->_freeRows[store->_nbFreeRow];
+  GAAdnStorePoint(store, adn);
+  // Initialise the vectors in the row with the current genes if any
+  long lengthAdnF = GAGetLengthAdnFloat(that);
+  long lengthAdnI = GAGetLengthAdnInt(that);
+  if (lengthAdnF > 0) {
+    adn->_adnF->_dim = lengthAdnF;
+    adn->_deltaAdnF->_dim = lengthAdnF;
+    adn->_mutabilityF->_dim = lengthAdnF;
+    if (adnF != NULL) {
+      VecCopy(adn->_adnF, adnF);
+      VecCopy(adn->_deltaAdnF, deltaAdnF);
+      VecCopy(adn->_mutabilityF, mutabilityF);
+    } else {
+      memset(adn->_adnF->_val, 0, sizeof(float) * lengthAdnF);
+      memset(adn->_deltaAdnF->_val, 0, sizeof(float) * lengthAdnF);
+      memset(adn->_mutabilityF->_val, 0, sizeof(float) * lengthAdnF);
+    }
+  }
+  if (lengthAdnI > 0) {
+    adn->_adnI->_dim = lengthAdnI;
+    adn->_mutabilityI->_dim = lengthAdnI;
+    if (adnI != NULL) {
+      VecCopy(adn->_adnI, adnI);
+      VecCopy(adn->_mutabilityI, mutabilityI);
+    } else {
+      memset(adn->_adnI->_val, 0, sizeof(long) * lengthAdnI);
+      memset(adn->_mutabilityI->_val, 0, sizeof(float) * lengthAdnI);
+    }
+  }
+  // Free the previous vectors
+  if (adnF != NULL)
+    VecFree(&adnF);
+  if (deltaAdnF != NULL)
+    VecFree(&deltaAdnF);
+  if (mutabilityF != NULL)
+    VecFree(&mutabilityF);
+  if (adnI != NULL)
+    VecFree(&adnI);
+  if (mutabilityI != NULL)
+    VecFree(&mutabilityI);
+}
+
+// Move the genes of the GenAlgAdn 'adn' out of the store of the 
+// GenAlg 'that' into vectors owned by 'adn'
+void GAAdnStoreDetach(GenAlg* const that, GenAlgAdn* const adn) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (adn == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'adn' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // If the adn is not in the store, nothing to do
+  if (adn->_iRow < 0)
+    return;
+  // Create the vectors owned by the adn as copies of the views
+  long lengthAdnF = GAGetLengthAdnFloat(that);
+  long lengthAdnI = GAGetLengthAdnInt(that);
+  VecFloat* adnF = NULL;
+  VecFloat* deltaAdnF = NULL;
+  VecFloat* mutabilityF = NULL;
+  VecLong* adnI = NULL;
+  VecFloat* mutabilityI = NULL;
+  if (lengthAdnF > 0) {
+    adnF = VecFloatCreate(lengthAdnF);
+    deltaAdnF = VecFloatCreate(lengthAdnF);
+    mutabilityF = VecFloatCreate(lengthAdnF);
+    VecCopy(adnF, adn->_adnF);
+    VecCopy(deltaAdnF, adn->_deltaAdnF);
+    VecCopy(mutabilityF, adn->_mutabilityF);
+  }
+  if (lengthAdnI > 0) {
+    adnI = VecLongCreate(lengthAdnI);
+    mutabilityI = VecFloatCreate(lengthAdnI);
+    VecCopy(adnI, adn->_adnI);
+    VecCopy(mutabilityI, adn->_mutabilityI);
+  }
+  // Give back the row
+  GAAdnStoreRelease(that, adn);
+  // Set the vectors
+  adn->_adnF = adnF;
+  adn->_deltaAdnF = deltaAdnF;
+  adn->_mutabilityF = mutabilityF;
+  adn->_adnI = adnI;
+  adn->_mutabilityI = mutabilityI;
+}
+
+// Give back the row of the GenAlgAdn 'adn' to the store of the 
+// GenAlg 'that', the vectors of 'adn' are set to null
+void GAAdnStoreRelease(GenAlg* const that, GenAlgAdn* const adn) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (adn == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'adn' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // If the adn is not in the store, nothing to do
+  if (adn->_iRow < 0)
+    return;
+  // Push the row on the stack of free rows
+  GAAdnStore* store = that->_store;
+  store->_freeRows[store->_nbFreeRow] = adn->_iRow;
+  ++(store->_nbFreeRow);
+  // Reset the views
+  adn->_iRow = -1;
+  adn->_adnF = NULL;
+  adn->_deltaAdnF = NULL;
+  adn->_mutabilityF = NULL;
+  adn->_adnI = NULL;
+  adn->_mutabilityI = NULL;
+}
+
+// Set the flag memorizing if the genes of the adns of the GenAlg 
+// 'that' are stored in contiguous slabs owned by the GenAlg to 'flag'
+// Current genes are preserved when switching between layouts
+void GASetFlagContiguousAdn(GenAlg* const that, const bool flag) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // If the layout is already the requested one, nothing to do
+  if (GAGetFlagContiguousAdn(that) == flag)
+    return;
+  if (flag == true) {
+    // Create the store with enough rows for the largest population 
+    // so it doesn't need to grow during the resizing in GAStep
+    that->_store = GAAdnStoreCreate(GAGetLengthAdnFloat(that), 
+      GAGetLengthAdnInt(that));
+    GAAdnStoreReserve(that, 
+      MAX(GAGetNbAdns(that), GAGetNbMaxAdn(that)));
+    // Move the adns into the store
+    GSetIterForward iter = GSetIterForwardCreateStatic(GAAdns(that));
+    do {
+      GenAlgAdn* adn = GSetIterGet(&iter);
+      GAAdnStoreAttach(that, adn);
+    } while (GSetIterStep(&iter));
+  } else {
+    // Move the adns out of the store
+    GSetIterForward iter = GSetIterForwardCreateStatic(GAAdns(that));
+    do {
+      GenAlgAdn* adn = GSetIterGet(&iter);
+      GAAdnStoreDetach(that, adn);
+    } while (GSetIterStep(&iter));
+    // Free the store
+    GAAdnStoreFree(&(that->_store));
+  }
+}
+
+// ------------- GAThreadPool
+
+// ================ Functions declaration ====================
+
+// Main function of the worker threads of the GAThreadPool 'arg'
+void* GAThreadPoolWorker(void* arg);
+
+// Execute the tasks of the current job of the GAThreadPool 'that'
+// from the thread 'iThread' until there is no more task
+void GAThreadPoolWork(GAThreadPool* const that, const int iThread);
+
+// ================ Functions implementation ====================
+
+// Create a new GAThreadPool with 'nbThread' threads (including the 
+// thread which will call GAThreadPoolRun)
+GAThreadPool* GAThreadPoolCreate(const int nbThread) {
+#if BUILDMODE == 0
+  if (nbThread < 1) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'nbThread' is invalid (%d>=1)", 
+      nbThread);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // Allocate memory
+  GAThreadPool* that = PBErrMalloc(GenAlgErr, sizeof(GAThreadPool));
+  // Set the properties
+  that->_nbThread = nbThread;
+  that->_run = 0;
+  that->_nbBusy = 0;
+  that->_flagStop = false;
+  that->_fun = NULL;
+  that->_data = NULL;
+  that->_nbTask = 0;
+  atomic_init(&(that->_nextTask), 0);
+  atomic_init(&(that->_nbStarted), 0);
+  pthread_mutex_init(&(that->_mutex), NULL);
+  pthread_cond_init(&(that->_condStart), NULL);
+  pthread_cond_init(&(that->_condEnd), NULL);
+  // Start the workers
+  that->_threads = NULL;
+  if (nbThread > 1) {
+    that->_threads = 
+      PBErrMalloc(GenAlgErr, sizeof(pthread_t) * (nbThread - 1));
+    for (int iThread = 0; iThread < nbThread - 1; ++iThread) {
+      if (pthread_create(that->_threads + iThread, NULL, 
+        GAThreadPoolWorker, that) != 0) {
+        GenAlgErr->_type = PBErrTypeOther;
+        sprintf(GenAlgErr->_msg, "Can't create the thread %d", 
+          iThread + 1);
+        PBErrCatch(GenAlgErr);
+      }
     }
-    if (!flag && that->_textOMeter != NULL) {
-      TextOMeterFree(&(that->_textOMeter));
+  }
+  // Return the new GAThreadPool
+  return that;
+}
+
+// Free the memory used by the GAThreadPool 'that', its workers are
+// stopped
+void GAThreadPoolFree(GAThreadPool** that) {
+  // Check the argument
+  if (that == NULL || *that == NULL) return;
+  // Stop the workers and wait for them
+  pthread_mutex_lock(&((*that)->_mutex));
+  (*that)->_flagStop = true;
+  pthread_cond_broadcast(&((*that)->_condStart));
+  pthread_mutex_unlock(&((*that)->_mutex));
+  for (int iThread = 0; iThread < (*that)->_nbThread - 1; ++iThread)
+    pthread_join((*that)->_threads[iThread], NULL);
+  // Free memory
+  pthread_cond_destroy(&((*that)->_condEnd));
+  pthread_cond_destroy(&((*that)->_condStart));
+  pthread_mutex_destroy(&((*that)->_mutex));
+  free((*that)->_threads);
+  free(*that);
+  *that = NULL;
+}
+
+// Execute the function 'fun' on the data 'data' for the 'nbTask' 
+// tasks using the threads of the GAThreadPool 'that'
+// Return when all the tasks have been executed
+void GAThreadPoolRun(GAThreadPool* const that, 
+  const GAThreadPoolFun fun, void* const data, const long nbTask) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (fun == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'fun' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // If there is no worker or not enough tasks to share, execute 
+  // the tasks from the calling thread
+  if (that->_nbThread == 1 || nbTask <= 1) {
+    for (long iTask = 0; iTask < nbTask; ++iTask)
+      fun(data, iTask, 0);
+    return;
+  }
+  // Publish the job and wake up the workers
+  pthread_mutex_lock(&(that->_mutex));
+  that->_fun = fun;
+  that->_data = data;
+  that->_nbTask = nbTask;
+  atomic_store(&(that->_nextTask), 0);
+  that->_nbBusy = that->_nbThread - 1;
+  ++(that->_run);
+  pthread_cond_broadcast(&(that->_condStart));
+  pthread_mutex_unlock(&(that->_mutex));
+  // Work on the job too
+  GAThreadPoolWork(that, 0);
+  // Wait for the workers to finish
+  pthread_mutex_lock(&(that->_mutex));
+  while (that->_nbBusy > 0)
+    pthread_cond_wait(&(that->_condEnd), &(that->_mutex));
+  that->_fun = NULL;
+  that->_data = NULL;
+  pthread_mutex_unlock(&(that->_mutex));
+}
+
+// Main function of the worker threads of the GAThreadPool 'arg'
+void* GAThreadPoolWorker(void* arg) {
+  GAThreadPool* that = (GAThreadPool*)arg;
+  // Get the index of this worker
+  int iThread = 1 + atomic_fetch_add(&(that->_nbStarted), 1);
+  // Loop until the pool is stopped
+  unsigned long run = 0;
+  pthread_mutex_lock(&(that->_mutex));
+  while (true) {
+    // Wait for a new job
+    while (that->_flagStop == false && that->_run == run)
+      pthread_cond_wait(&(that->_condStart), &(that->_mutex));
+    if (that->_flagStop == true)
+      break;
+    run = that->_run;
+    pthread_mutex_unlock(&(that->_mutex));
+    // Execute the tasks
+    GAThreadPoolWork(that, iThread);
+    // Signal the end of this worker's part of the job
+    pthread_mutex_lock(&(that->_mutex));
+    --(that->_nbBusy);
+    if (that->_nbBusy == 0)
+      pthread_cond_signal(&(that->_condEnd));
+  }
+  pthread_mutex_unlock(&(that->_mutex));
+  return NULL;
+}
+
+// Execute the tasks of the current job of the GAThreadPool 'that'
+// from the thread 'iThread' until there is no more task
+void GAThreadPoolWork(GAThreadPool* const that, const int iThread) {
+  while (true) {
+    long iTask = atomic_fetch_add(&(that->_nextTask), 1);
+    if (iTask >= that->_nbTask)
+      break;
+    that->_fun(that->_data, iTask, iThread);
+  }
+}
+
+// ------------- GAIOWriter
+
+// ================ Functions declaration ====================
+
+// Main function of the thread of the GAIOWriter 'arg'
+void* GAIOWriterMain(void* arg);
+
+// ================ Functions implementation ====================
+
+// Create a new GAIOWriter and start its thread
+GAIOWriter* GAIOWriterCreate(void) {
+  // Allocate memory
+  GAIOWriter* that = PBErrMalloc(GenAlgErr, sizeof(GAIOWriter));
+  // Set the properties
+  that->_first = NULL;
+  that->_last = NULL;
+  that->_sizeQueued = 0;
+  that->_flagBusy = false;
+  that->_flagError = false;
+  that->_flagStop = false;
+  pthread_mutex_init(&(that->_mutex), NULL);
+  pthread_cond_init(&(that->_condJob), NULL);
+  pthread_cond_init(&(that->_condDone), NULL);
+  // Start the thread
+  if (pthread_create(&(that->_thread), NULL, GAIOWriterMain, that) != 0) {
+    GenAlgErr->_type = PBErrTypeOther;
+    sprintf(GenAlgErr->_msg, "Can't create the writer thread");
+    PBErrCatch(GenAlgErr);
+  }
+  // Return the new GAIOWriter
+  return that;
+}
+
+// Free the memory used by the GAIOWriter 'that', its thread is 
+// stopped after writing the pending jobs
+void GAIOWriterFree(GAIOWriter** that) {
+  // Check the argument
+  if (that == NULL || *that == NULL) return;
+  // Stop the thread and wait for it
+  pthread_mutex_lock(&((*that)->_mutex));
+  (*that)->_flagStop = true;
+  pthread_cond_signal(&((*that)->_condJob));
+  pthread_mutex_unlock(&((*that)->_mutex));
+  pthread_join((*that)->_thread, NULL);
+  // Free memory
+  pthread_cond_destroy(&((*that)->_condDone));
+  pthread_cond_destroy(&((*that)->_condJob));
+  pthread_mutex_destroy(&((*that)->_mutex));
+  free(*that);
+  *that = NULL;
+}
+
+// Queue the 'size' bytes 'data' to be written to the stream 'stream'
+// by the GAIOWriter 'that', which takes the ownership of 'data'
+// Wait if more than GENALG_IO_MAXQUEUE bytes are already queued
+void GAIOWriterPush(GAIOWriter* const that, FILE* const stream, 
+  char* const data, const size_t size) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (stream == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'stream' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // Create the job
+  GAIOJob* job = PBErrMalloc(GenAlgErr, sizeof(GAIOJob));
+  job->_data = data;
+  job->_size = size;
+  job->_stream = stream;
+  job->_next = NULL;
+  pthread_mutex_lock(&(that->_mutex));
+  // Wait for the writer if it's too late
+  while (that->_sizeQueued > 0 && 
+    that->_sizeQueued + size > GENALG_IO_MAXQUEUE)
+    pthread_cond_wait(&(that->_condDone), &(that->_mutex));
+  // Add the job to the queue and wake up the writer
+  if (that->_last == NULL)
+    that->_first = job;
+  else
+    that->_last->_next = job;
+  that->_last = job;
+  that->_sizeQueued += size;
+  pthread_cond_signal(&(that->_condJob));
+  pthread_mutex_unlock(&(that->_mutex));
+}
+
+// Wait until all the jobs of the GAIOWriter 'that' have been written
+// Return false if a write has failed since the creation of the 
+// GAIOWriter or the last call to GAIOWriterResetError, true else
+bool GAIOWriterWait(GAIOWriter* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  pthread_mutex_lock(&(that->_mutex));
+  while (that->_first != NULL || that->_flagBusy == true)
+    pthread_cond_wait(&(that->_condDone), &(that->_mutex));
+  bool ret = !(that->_flagError);
+  pthread_mutex_unlock(&(that->_mutex));
+  return ret;
+}
+
+// Reset the error flag of the GAIOWriter 'that'
+void GAIOWriterResetError(GAIOWriter* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  pthread_mutex_lock(&(that->_mutex));
+  that->_flagError = false;
+  pthread_mutex_unlock(&(that->_mutex));
+}
+
+// Main function of the thread of the GAIOWriter 'arg'
+void* GAIOWriterMain(void* arg) {
+  GAIOWriter* that = (GAIOWriter*)arg;
+  pthread_mutex_lock(&(that->_mutex));
+  while (true) {
+    // Wait for a job, stop only once the queue is empty
+    while (that->_flagStop == false && that->_first == NULL)
+      pthread_cond_wait(&(that->_condJob), &(that->_mutex));
+    if (that->_first == NULL)
+      break;
+    GAIOJob* job = that->_first;
+    that->_first = job->_next;
+    if (that->_first == NULL)
+      that->_last = NULL;
+    that->_flagBusy = true;
+    pthread_mutex_unlock(&(that->_mutex));
+    // Write the job
+    bool ret = (fwrite(job->_data, 1, job->_size, job->_stream) == 
+      job->_size) && (fflush(job->_stream) == 0);
+    size_t size = job->_size;
+    free(job->_data);
+    free(job);
+    // Signal the end of the job
+    pthread_mutex_lock(&(that->_mutex));
+    if (ret == false)
+      that->_flagError = true;
+    that->_sizeQueued -= size;
+    that->_flagBusy = false;
+    pthread_cond_broadcast(&(that->_condDone));
+  }
+  pthread_mutex_unlock(&(that->_mutex));
+  return NULL;
+}
+
+// ------------- GAGenealogy
+
+// ================ Functions declaration ====================
+
+// Get the index of the node of the adn 'id' in the GAGenealogy 
+// 'that', -1 if it's not in the genealogy
+long GAGenealogyGetNode(const GAGenealogy* const that, 
+  const unsigned long id);
+
+// Get the slot of the id 'id' in the hash table of the GAGenealogy 
+// 'that', i.e. the slot of its node or the empty slot where to insert
+// it
+long GAGenealogyGetSlot(const GAGenealogy* const that, 
+  const unsigned long id);
+
+// Resize the hash table of the GAGenealogy 'that' to 'nbSlot' slots
+void GAGenealogyRehash(GAGenealogy* const that, const long nbSlot);
+
+// Reallocate the memory 'ptr' to 'size' bytes
+void* GAGenealogyRealloc(void* const ptr, const size_t size);
+
+// Visit the ancestors (if 'flagUp' is true) or the descendants (else)
+// of the node 'iNode' of the GAGenealogy 'that' in breadth first 
+// order, and store their ids in '_ids'
+// Return the number of visited nodes
+long GAGenealogyTraverse(GAGenealogy* const that, const long iNode,
+  const bool flagUp);
+
+// ================ Functions implementation ====================
+
+// Create a new empty GAGenealogy
+GAGenealogy* GAGenealogyCreate(void) {
+  // Allocate memory
+  GAGenealogy* that = PBErrMalloc(GenAlgErr, sizeof(GAGenealogy));
+  // Set the properties
+  that->_nodes = NULL;
+  that->_nbNode = 0;
+  that->_nbMaxNode = 0;
+  that->_links = NULL;
+  that->_nbLink = 0;
+  that->_nbMaxLink = 0;
+  that->_slots = NULL;
+  that->_nbSlot = 0;
+  that->_stamp = 0;
+  that->_ids = NULL;
+  // Return the new GAGenealogy
+  return that;
+}
+
+// Free the memory used by the GAGenealogy 'that'
+void GAGenealogyFree(GAGenealogy** that) {
+  // Check the argument
+  if (that == NULL || *that == NULL) return;
+  // Free memory
+  free((*that)->_nodes);
+  free((*that)->_links);
+  free((*that)->_slots);
+  free((*that)->_ids);
+  free(*that);
+  *that = NULL;
+}
+
+// Remove all the adns of the GAGenealogy 'that', its memory is kept 
+// for reuse
+void GAGenealogyFlush(GAGenealogy* const that) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  that->_nbNode = 0;
+  that->_nbLink = 0;
+  for (long iSlot = that->_nbSlot; iSlot--;)
+    that->_slots[iSlot] = -1;
+}
+
+// Add the birth 'birth' to the GAGenealogy 'that'
+// The births of an adn already in the genealogy (the elites recorded 
+// at each epoch) are ignored
+void GAGenealogyAdd(GAGenealogy* const that, 
+  const GAHistoryBirth* const birth) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (birth == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'birth' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // If the adn is already in the genealogy, nothing to do
+  if (GAGenealogyGetNode(that, birth->_idChild) != -1)
+    return;
+  // Make room for the new node and its links, keeping the hash table
+  // at most half full
+  if (that->_nbNode == that->_nbMaxNode) {
+    that->_nbMaxNode = (that->_nbMaxNode == 0 ? 
+      GENALG_HISTORY_CHUNK : 2 * that->_nbMaxNode);
+    that->_nodes = GAGenealogyRealloc(that->_nodes, 
+      sizeof(GAGenealogyNode) * that->_nbMaxNode);
+    that->_ids = GAGenealogyRealloc(that->_ids, 
+      sizeof(unsigned long) * that->_nbMaxNode);
+  }
+  if (that->_nbLink + 2 > that->_nbMaxLink) {
+    that->_nbMaxLink = (that->_nbMaxLink == 0 ? 
+      2 * GENALG_HISTORY_CHUNK : 2 * that->_nbMaxLink);
+    that->_links = GAGenealogyRealloc(that->_links, 
+      sizeof(GAGenealogyLink) * that->_nbMaxLink);
+  }
+  if (2 * (that->_nbNode + 1) > that->_nbSlot)
+    GAGenealogyRehash(that, (that->_nbSlot == 0 ? 
+      2 * GENALG_HISTORY_CHUNK : 2 * that->_nbSlot));
+  // Create the node
+  long iNode = that->_nbNode;
+  GAGenealogyNode* node = that->_nodes + iNode;
+  node->_birth = *birth;
+  node->_firstChild = -1;
+  node->_depth = 0;
+  node->_stamp = 0;
+  for (int iParent = 0; iParent < 2; ++iParent) {
+    // The adns created by GAInit are their own parents
+    long iNodeParent = -1;
+    if (birth->_idParents[iParent] != birth->_idChild)
+      iNodeParent = GAGenealogyGetNode(that, birth->_idParents[iParent]);
+    // Link each parent once to the child
+    if (iParent == 1 && iNodeParent == node->_parents[0])
+      iNodeParent = -1;
+    node->_parents[iParent] = iNodeParent;
+    if (iNodeParent != -1) {
+      GAGenealogyNode* parent = that->_nodes + iNodeParent;
+      if (node->_depth < parent->_depth + 1)
+        node->_depth = parent->_depth + 1;
+      that->_links[that->_nbLink]._child = iNode;
+      that->_links[that->_nbLink]._next = parent->_firstChild;
+      parent->_firstChild = that->_nbLink;
+      ++(that->_nbLink);
     }
-    that->_flagTextOMeter = flag;
   }
+  // Add the node to the hash table
+  that->_slots[GAGenealogyGetSlot(that, birth->_idChild)] = iNode;
+  ++(that->_nbNode);
 }
 
-// Refresh the content of the TextOMeter attached to the GenAlg 'that'
-void GAUpdateTextOMeter(const GenAlg* const that) {
+// Get the birth of the adn 'id' in the GAGenealogy 'that', NULL if 
+// it's not in the genealogy
+const GAHistoryBirth* GAGenealogyGetBirth(const GAGenealogy* const that,
+  const unsigned long id) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
     sprintf(GenAlgErr->_msg, "'that' is null");
     PBErrCatch(GenAlgErr);
   }
-  if (that->_textOMeter == NULL) {
+#endif
+  long iNode = GAGenealogyGetNode(that, id);
+  return (iNode == -1 ? NULL : &(that->_nodes[iNode]._birth));
+}
+
+// Get the lineage depth of the adn 'id' in the GAGenealogy 'that', 
+// i.e. the number of generations on the longest path to the adns 
+// without parents, -1 if it's not in the genealogy
+long GAGenealogyGetDepth(const GAGenealogy* const that, 
+  const unsigned long id) {
+#if BUILDMODE == 0
+  if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
-    sprintf(GenAlgErr->_msg, "'that->_textOMeter' is null");
+    sprintf(GenAlgErr->_msg, "'that' is null");
     PBErrCatch(GenAlgErr);
   }
 #endif
-  // Clear the TextOMeter
-  TextOMeterClear(that->_textOMeter);
-  // Declare a variable to print the content of the TextOMeter
-  char str[50];
-  // Print the content of the TextOMeter
-  // Epoch #xxxxxx  KTEvent #xxxxxx
-  sprintf(str, GENALG_TXTOMETER_FORMAT1, 
-    GAGetCurEpoch(that), GAGetNbKTEvent(that));
-  TextOMeterPrint(that->_textOMeter, str);
-  // Diversity +xxxxxx.xxxxxx
-  sprintf(str, GENALG_TXTOMETER_FORMAT5, GAGetDiversity(that), 
-    GAGetDiversityThreshold(that));
-  TextOMeterPrint(that->_textOMeter, str);
-  // Nb adns xxxxxx
-  sprintf(str, GENALG_TXTOMETER_FORMAT6, GAGetNbAdns(that));
-  TextOMeterPrint(that->_textOMeter, str);
-  //
-  sprintf(str, "\n");
-  TextOMeterPrint(that->_textOMeter, str);
-  // Id      Age     Val
-  sprintf(str, GENALG_TXTOMETER_LINE2);
-  TextOMeterPrint(that->_textOMeter, str);
-  // xxxxxx  xxxxxx  +xxxxxx.xxxx
-  sprintf(str, GENALG_TXTOMETER_FORMAT3, 
-    GAAdnGetId(GABestAdn(that)), GAAdnGetAge(GABestAdn(that)),
-    GAAdnGetVal(GABestAdn(that)));
-  TextOMeterPrint(that->_textOMeter, str);
-  // .........................
-  sprintf(str, GENALG_TXTOMETER_LINE4);
-  TextOMeterPrint(that->_textOMeter, str);
-  // xxxxxx  xxxxxx  +xxxxxx.xxxx
-  for (int iRank = 0; iRank < GAGetNbElites(that); ++iRank) {
-    sprintf(str, GENALG_TXTOMETER_FORMAT3, 
-      GAAdnGetId(GAAdn(that, iRank)), GAAdnGetAge(GAAdn(that, iRank)),
-      GAAdnGetVal(GAAdn(that, iRank)));
-    TextOMeterPrint(that->_textOMeter, str);
+  long iNode = GAGenealogyGetNode(that, id);
+  return (iNode == -1 ? -1 : that->_nodes[iNode]._depth);
+}
+
+// Get the ids of all the ancestors of the adn 'id' in the 
+// GAGenealogy 'that', from the nearest to the furthest generation
+// '*ids' points to an array owned by the GAGenealogy, valid until the
+// next query or modification
+// Return the number of ancestors, -1 if the adn is not in the 
+// genealogy
+long GAGenealogyGetAncestors(GAGenealogy* const that, 
+  const unsigned long id, const unsigned long** const ids) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
   }
-  // .........................
-  sprintf(str, GENALG_TXTOMETER_LINE4);
-  TextOMeterPrint(that->_textOMeter, str);
-  // xxxxxx  xxxxxx  +xxxxxx.xxxx
-  int maxRank = MIN(GENALG_TXTOMETER_NBADNDISPLAYED, GAGetNbAdns(that));
-  for (int iRank = GAGetNbElites(that); iRank < maxRank; ++iRank) {
-    sprintf(str, GENALG_TXTOMETER_FORMAT3, 
-      GAAdnGetId(GAAdn(that, iRank)), GAAdnGetAge(GAAdn(that, iRank)),
-      GAAdnGetVal(GAAdn(that, iRank)));
-    TextOMeterPrint(that->_textOMeter, str);
+  if (ids == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'ids' is null");
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  *ids = that->_ids;
+  long iNode = GAGenealogyGetNode(that, id);
+  return (iNode == -1 ? -1 : GAGenealogyTraverse(that, iNode, true));
+}
+
+// Get the ids of all the descendants of the adn 'id' in the 
+// GAGenealogy 'that', from the nearest to the furthest generation
+// '*ids' points to an array owned by the GAGenealogy, valid until the
+// next query or modification
+// Return the number of descendants, -1 if the adn is not in the 
+// genealogy
+long GAGenealogyGetDescendants(GAGenealogy* const that, 
+  const unsigned long id, const unsigned long** const ids) {
+#if BUILDMODE == 0
+  if (that == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (ids == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'ids' is null");
+    PBErrCatch(GenAlgErr);
   }
-  // Fill in with blank lines if necessary
-  sprintf(str, "\n");
-  for (int iBlank = GAGetNbAdns(that); 
-    iBlank < GENALG_TXTOMETER_NBADNDISPLAYED; ++iBlank) {
-    TextOMeterPrint(that->_textOMeter, str);
+#endif
+  *ids = that->_ids;
+  long iNode = GAGenealogyGetNode(that, id);
+  return (iNode == -1 ? -1 : GAGenealogyTraverse(that, iNode, false));
+}
+
+// Get the index of the node of the adn 'id' in the GAGenealogy 
+// 'that', -1 if it's not in the genealogy
+long GAGenealogyGetNode(const GAGenealogy* const that, 
+  const unsigned long id) {
+  if (that->_nbNode == 0)
+    return -1;
+  return that->_slots[GAGenealogyGetSlot(that, id)];
+}
+
+// Get the slot of the id 'id' in the hash table of the GAGenealogy 
+// 'that', i.e. the slot of its node or the empty slot where to insert
+// it
+long GAGenealogyGetSlot(const GAGenealogy* const that, 
+  const unsigned long id) {
+  uint64_t hash = (uint64_t)id * 0x9E3779B97F4A7C15ULL;
+  long iSlot = (long)((hash ^ (hash >> 32)) & (that->_nbSlot - 1));
+  // Linear probing, the table is never full
+  while (that->_slots[iSlot] != -1 && 
+    that->_nodes[that->_slots[iSlot]]._birth._idChild != id)
+    iSlot = (iSlot + 1) & (that->_nbSlot - 1);
+  return iSlot;
+}
+
+// Resize the hash table of the GAGenealogy 'that' to 'nbSlot' slots
+void GAGenealogyRehash(GAGenealogy* const that, const long nbSlot) {
+  free(that->_slots);
+  that->_slots = PBErrMalloc(GenAlgErr, sizeof(long) * nbSlot);
+  that->_nbSlot = nbSlot;
+  for (long iSlot = nbSlot; iSlot--;)
+    that->_slots[iSlot] = -1;
+  for (long iNode = 0; iNode < that->_nbNode; ++iNode) {
+    long iSlot = GAGenealogyGetSlot(that, 
+      that->_nodes[iNode]._birth._idChild);
+    that->_slots[iSlot] = iNode;
   }
-  // If there are more adns than availalbe space in the TextOMeter
-  if (GAGetNbAdns(that)> GENALG_TXTOMETER_NBADNDISPLAYED) {
-    sprintf(str, "...");
-    TextOMeterPrint(that->_textOMeter, str);
+}
+
+// Reallocate the memory 'ptr' to 'size' bytes
+void* GAGenealogyRealloc(void* const ptr, const size_t size) {
+  void* ret = realloc(ptr, size);
+  if (ret == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "realloc failed");
+    PBErrCatch(GenAlgErr);
   }
-  // Flush the content of the TextOMeter
-  TextOMeterFlush(that->_textOMeter);
+  return ret;
 }
-  
-// Create a static GAHistory
-GAHistory GAHistoryCreateStatic(void) {
-  // Declare the new GAHistory
-  GAHistory that;
-  // Init properties
-  that._genealogy = GSetCreateStatic();
-  that._path = strdup("./genAlgHistory.json");
-  // Return the new GAHistory
+
+// Visit the ancestors (if 'flagUp' is true) or the descendants (else)
+// of the node 'iNode' of the GAGenealogy 'that' in breadth first 
+// order, and store their ids in '_ids'
+// Return the number of visited nodes
+long GAGenealogyTraverse(GAGenealogy* const that, const long iNode,
+  const bool flagUp) {
+  // Use a new stamp to mark the visited nodes, and '_ids' as the 
+  // queue of the indices of the visited nodes
+  ++(that->_stamp);
+  that->_nodes[iNode]._stamp = that->_stamp;
+  unsigned long* queue = that->_ids;
+  long nb = 0;
+  long iHead = 0;
+  long iCur = iNode;
+  while (iCur != -1) {
+    const GAGenealogyNode* node = that->_nodes + iCur;
+    if (flagUp == true) {
+      for (int iParent = 0; iParent < 2; ++iParent) {
+        long iNext = node->_parents[iParent];
+        if (iNext != -1 && that->_nodes[iNext]._stamp != that->_stamp) {
+          that->_nodes[iNext]._stamp = that->_stamp;
+          queue[nb++] = iNext;
+        }
+      }
+    } else {
+      for (long iLink = node->_firstChild; iLink != -1; 
+        iLink = that->_links[iLink]._next) {
+        long iNext = that->_links[iLink]._child;
+        if (that->_nodes[iNext]._stamp != that->_stamp) {
+          that->_nodes[iNext]._stamp = that->_stamp;
+          queue[nb++] = iNext;
+        }
+      }
+    }
+    iCur = (iHead < nb ? (long)queue[iHead++] : -1);
+  }
+  // Convert the indices of the nodes into ids
+  for (long i = 0; i < nb; ++i)
+    queue[i] = that->_nodes[queue[i]]._birth._idChild;
+  return nb;
+}
+
+// ------------- GAIslands
+
+// ================ Functions declaration ====================
+
+// Data shared by the threads of GAIslandsStep
+typedef struct GAIslandsJob {
+  // The GAIslands
+  GAIslands* _islands;
+  // Evaluation function and its user data
+  GAEvalFun _fun;
+  void* _data;
+} GAIslandsJob;
+
+// Evaluate and step 'period' epochs of the 'iTask'-th island of the 
+// GAIslandsJob 'data' from the thread 'iThread'
+void GAIslandsStepTask(void* const data, const long iTask, 
+  const int iThread);
+
+// Migrate the best adns of each island of the GAIslands 'that' into 
+// the non elite adns of its destinations
+void GAIslandsMigrate(GAIslands* const that);
+
+// Replace the genes of the GenAlgAdn 'adn' of the GenAlg 'that' with 
+// the ones of the GenAlgAdn 'migrant' from another island
+void GAIslandsMigrateAdn(GenAlg* const that, GenAlgAdn* const adn,
+  const GenAlgAdn* const migrant);
+
+// ================ Functions implementation ====================
+
+// Create a new GAIslands with 'nbIsland' GenAlg created with 
+// 'nbEntities', 'nbElites', 'lengthAdnF' and 'lengthAdnI' (cf 
+// GenAlgCreate)
+// By default the topology is gaMigrationRing, the period is 10 epochs 
+// and one elite migrates
+// The islands must be configured with GAIslandsGenAlg and initialised
+// with GAIslandsInit
+GAIslands* GAIslandsCreate(const int nbIsland, const int nbEntities, 
+  const int nbElites, const long lengthAdnF, const long lengthAdnI) {
+#if BUILDMODE == 0
+  if (nbIsland < 1) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'nbIsland' is invalid (%d>=1)", 
+      nbIsland);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // Allocate memory
+  GAIslands* that = PBErrMalloc(GenAlgErr, sizeof(GAIslands));
+  that->_islands = PBErrMalloc(GenAlgErr, sizeof(GenAlg*) * nbIsland);
+  // Create the islands
+  for (int iIsland = 0; iIsland < nbIsland; ++iIsland)
+    that->_islands[iIsland] = 
+      GenAlgCreate(nbEntities, nbElites, lengthAdnF, lengthAdnI);
+  // Set the properties
+  that->_nbIsland = nbIsland;
+  that->_topology = gaMigrationRing;
+  that->_period = 10;
+  that->_nbMigrant = 1;
+  that->_nbMigration = 0;
+  that->_pool = NULL;
+  // Return the new GAIslands
   return that;
 }
 
-// Free the memory used by the GAHistory 'that'
-void GAHistoryFree(GAHistory* that) {
+// Free the memory used by the GAIslands 'that' and its islands
+void GAIslandsFree(GAIslands** that) {
+  // Check the argument
+  if (that == NULL || *that == NULL) return;
+  // Free memory
+  GAThreadPoolFree(&((*that)->_pool));
+  for (int iIsland = 0; iIsland < (*that)->_nbIsland; ++iIsland)
+    GenAlgFree((*that)->_islands + iIsland);
+  free((*that)->_islands);
+  free(*that);
+  *that = NULL;
+}
+
+// Set the seed of the 'iIsland'-th island of the GAIslands 'that' 
+// to 'seed' + 'iIsland'
+void GAIslandsSetSeed(GAIslands* const that, const unsigned long seed) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
@@ -2200,14 +6932,13 @@ void GAHistoryFree(GAHistory* that) {
     PBErrCatch(GenAlgErr);
   }
 #endif
-  // Flush the history
-  GAHistoryFlush(that);
-  // Free memory
-  free(that->_path);
+  for (int iIsland = 0; iIsland < that->_nbIsland; ++iIsland)
+    GASetSeed(that->_islands[iIsland], seed + (unsigned long)iIsland);
 }
 
-// Flush the content of the GAHistory 'that'
-void GAHistoryFlush(GAHistory* that) {
+// Init the islands of the GAIslands 'that'
+// Must be called after the bounds of the islands have been set
+void GAIslandsInit(GAIslands* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
@@ -2215,173 +6946,546 @@ void GAHistoryFlush(GAHistory* that) {
     PBErrCatch(GenAlgErr);
   }
 #endif
-  // Loop on the genealogy
-  while (GSetNbElem(&(that->_genealogy)) > 0) {
-    // Pop the birth
-    GAHistoryBirth* birth = GSetPop(&(that->_genealogy));
-    // Free memory
-    free(birth);
-  }
+  for (int iIsland = 0; iIsland < that->_nbIsland; ++iIsland)
+    GAInit(that->_islands[iIsland]);
 }
 
-// Save the history of the GenAlg 'that'
-bool GASaveHistory(const GenAlg* const that) {
+// Evaluate and step 'period' epochs of each island of the GAIslands 
+// 'that' concurrently, the islands' new adns being evaluated with the
+// function 'fun' and the user data 'data', then migrate the best 
+// adns of each island into the non elite adns of its destinations
+// 'fun' is called with the index of the thread of the island and 
+// must be thread safe
+// The migrants keep their value and are not evaluated again
+// The result doesn't depend on the scheduling of the threads
+void GAIslandsStep(GAIslands* const that, const GAEvalFun fun, 
+  void* const data) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
     sprintf(GenAlgErr->_msg, "'that' is null");
     PBErrCatch(GenAlgErr);
   }
+  if (fun == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'fun' is null");
+    PBErrCatch(GenAlgErr);
+  }
 #endif
-  // Get the JSON encoding
-  JSONNode* json = GAHistoryEncodeAsJSON(&(that->_history));
-  // Open the stream
-  FILE* stream = fopen(that->_history._path, "w");
-  // Save the JSON
-  bool compact = true;
-  if (!JSONSave(json, stream, compact)) {
-    return false;
+  // Step the islands, each one on its own thread
+  if (that->_pool == NULL)
+    that->_pool = GAThreadPoolCreate(that->_nbIsland);
+  GAIslandsJob job = {that, fun, data};
+  GAThreadPoolRun(that->_pool, GAIslandsStepTask, &job, 
+    that->_nbIsland);
+  // Exchange the best adns from the calling thread, once all the 
+  // islands have been stepped
+  GAIslandsMigrate(that);
+}
+
+// Evaluate and step 'period' epochs of the 'iTask'-th island of the 
+// GAIslandsJob 'data' from the thread 'iThread'
+void GAIslandsStepTask(void* const data, const long iTask, 
+  const int iThread) {
+  GAIslandsJob* job = (GAIslandsJob*)data;
+  GenAlg* ga = job->_islands->_islands[iTask];
+  for (unsigned long iEpoch = 0; iEpoch < job->_islands->_period; 
+    ++iEpoch) {
+    // Evaluate the new adns, the island being only accessed by this
+    // thread their values can be set immediately
+    for (int iAdn = 0; iAdn < GAGetNbAdns(ga); ++iAdn) {
+      GenAlgAdn* adn = GAAdn(ga, iAdn);
+      if (GAAdnIsNew(adn))
+        GASetAdnValue(ga, adn, job->_fun(adn, job->_data, iThread));
+    }
+    GAStep(ga);
   }
-  // Close the stream
-  fclose(stream);
-  // Free memory
-  JSONFree(&json);
-  // Return the success code
-  return true;
 }
 
+// Migrate the best adns of each island of the GAIslands 'that' into 
+// the non elite adns of its destinations
+void GAIslandsMigrate(GAIslands* const that) {
+  // Get the number of sources of each island
+  int nbSrc = 0;
+  if (that->_topology == gaMigrationRing)
+    nbSrc = MIN(1, that->_nbIsland - 1);
+  else
+    nbSrc = that->_nbIsland - 1;
+  // For each destination island
+  for (int iDst = 0; iDst < that->_nbIsland; ++iDst) {
+    GenAlg* dst = that->_islands[iDst];
+    // The migrants replace the worst non elite adns, so the elites 
+    // of the islands, which are the migrants, are never overwritten
+    int nbSlot = GAGetNbAdns(dst) - GAGetNbElites(dst);
+    int iSlot = 0;
+    // For each source island, starting from the previous one
+    for (int iSrc = 1; iSrc <= nbSrc; ++iSrc) {
+      GenAlg* src = 
+        that->_islands[(iDst - iSrc + that->_nbIsland) % that->_nbIsland];
+      int nbMigrant = MIN(that->_nbMigrant, GAGetNbElites(src));
+      for (int iMigrant = 0; iMigrant < nbMigrant && iSlot < nbSlot;
+        ++iMigrant, ++iSlot) {
+        GAIslandsMigrateAdn(dst, 
+          GAAdn(dst, GAGetNbAdns(dst) - 1 - iSlot), 
+          GAAdn(src, iMigrant));
+      }
+    }
+  }
+  ++(that->_nbMigration);
+}
+
+// Replace the genes of the GenAlgAdn 'adn' of the GenAlg 'that' with 
+// the ones of the GenAlgAdn 'migrant' from another island
+void GAIslandsMigrateAdn(GenAlg* const that, GenAlgAdn* const adn,
+  const GenAlgAdn* const migrant) {
+  if (migrant->_adnF != NULL) {
+    VecCopy(adn->_adnF, migrant->_adnF);
+    VecCopy(adn->_deltaAdnF, migrant->_deltaAdnF);
+  }
+  if (migrant->_adnI != NULL)
+    VecCopy(adn->_adnI, migrant->_adnI);
+  // The migrant is a new adn of this island
+  adn->_id = (that->_nextId)++;
+  adn->_idParents[0] = adn->_id;
+  adn->_idParents[1] = adn->_id;
+  adn->_age = 1;
+  // Keep the value of the migrant if it has been evaluated, as if it 
+  // had been found in the fitness cache
+  if (GAAdnIsNew(migrant)) {
+    adn->_flagCachedVal = false;
+  } else {
+    GASetAdnValue(that, adn, GAAdnGetVal(migrant));
+    adn->_flagCachedVal = true;
+  }
+}
 
-// Function which return the JSON encoding of the GAHistory 'that' 
-JSONNode* GAHistoryEncodeAsJSON(const GAHistory* const that) {
+// Return the best adn amongst the best adns of the islands of the 
+// GAIslands 'that'
+const GenAlgAdn* GAIslandsBestAdn(const GAIslands* const that) {
 #if BUILDMODE == 0
   if (that == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'that' is null");
-    PBErrCatch(PBMathErr);
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'that' is null");
+    PBErrCatch(GenAlgErr);
   }
 #endif
-  // Create the JSON structure
-  JSONNode* json = JSONCreate();
-  // Declare a buffer to convert value into string
-  char val[100];
+  const GenAlgAdn* best = GABestAdn(that->_islands[0]);
+  for (int iIsland = 1; iIsland < that->_nbIsland; ++iIsland) {
+    const GenAlgAdn* adn = GABestAdn(that->_islands[iIsland]);
+    if (GAAdnGetVal(adn) > GAAdnGetVal(best))
+      best = adn;
+  }
+  return best;
+}
 
-  // Array of birth
-  JSONArrayStruct genealogy = JSONArrayStructCreateStatic();
-  // Loop on the births
-  GSetIterForward iter = 
-    GSetIterForwardCreateStatic(
-      &(that->_genealogy));
-  do {
-    // Get the birth
-    GAHistoryBirth* birth = GSetIterGet(&iter);
-    // Encode the birth
-    JSONNode* birthJson = JSONCreate();
-    sprintf(val, "%ld", birth->_epoch);
-    JSONAddProp(birthJson, "_epoch", val);
-    sprintf(val, "%ld", birth->_idParents[0]);
-    JSONAddProp(birthJson, "_father", val);
-    sprintf(val, "%ld", birth->_idParents[1]);
-    JSONAddProp(birthJson, "_mother", val);
-    sprintf(val, "%ld", birth->_idChild);
-    JSONAddProp(birthJson, "_id", val);
-    // Add the birth to the array
-    JSONArrayStructAdd(&genealogy, birthJson);
-  } while (GSetIterStep(&iter));
-  // Add the genealogy
-  JSONAddProp(json, "_genealogy", &genealogy);
-  // Flush the temporary node for the genealogy
-  JSONArrayStructFlush(&genealogy);
-  // Return the created JSON 
-  return json;
+// ------------- GAWorkerPool
+
+// ================ Functions declaration ====================
+
+// Write the 'size' bytes 'buffer' on the socket 'fd'
+// Return false if the connection failed
+bool GAWorkerWrite(const int fd, const void* const buffer, 
+  const size_t size);
+
+// Read 'size' bytes from the socket 'fd' into 'buffer'
+// Return false if the connection failed
+bool GAWorkerRead(const int fd, void* const buffer, const size_t size);
+
+// Ensure the buffer of the GAWorkerPool 'that' can hold 'size' bytes
+void GAWorkerPoolReserve(GAWorkerPool* const that, const size_t size);
+
+// Send the 'nb' candidates 'adns' of the GenAlg 'ga' to the 
+// 'iWorker'-th worker of the GAWorkerPool 'that'
+// Return false if the connection failed
+bool GAWorkerPoolSend(GAWorkerPool* const that, const int iWorker,
+  const GenAlg* const ga, GenAlgAdn** const adns, const long nb);
+
+// Close the connection to the failed 'iWorker'-th worker of the 
+// GAWorkerPool 'that' and kill it
+void GAWorkerPoolFail(GAWorkerPool* const that, const int iWorker);
+
+// Return the current time in ms of the monotonic clock
+long GAWorkerPoolGetTime(void);
+
+// ================ Functions implementation ====================
+
+// Create a new GAWorkerPool with 'nbWorker' processes running the 
+// executable 'path', the socket to the pool being their standard 
+// input (cf GAWorkerServe)
+// By default a request contains at most 16 candidates and the 
+// workers have no time limit to reply
+GAWorkerPool* GAWorkerPoolCreate(const char* const path, 
+  const int nbWorker) {
+#if BUILDMODE == 0
+  if (path == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'path' is null");
+    PBErrCatch(GenAlgErr);
+  }
+  if (nbWorker < 1) {
+    GenAlgErr->_type = PBErrTypeInvalidArg;
+    sprintf(GenAlgErr->_msg, "'nbWorker' is invalid (%d>=1)", 
+      nbWorker);
+    PBErrCatch(GenAlgErr);
+  }
+#endif
+  // Allocate memory
+  GAWorkerPool* that = PBErrMalloc(GenAlgErr, sizeof(GAWorkerPool));
+  that->_workers = PBErrMalloc(GenAlgErr, sizeof(GAWorker) * nbWorker);
+  // Set the properties
+  that->_nbWorker = nbWorker;
+  that->_maxBatch = 16;
+  that->_timeout = -1;
+  that->_buffer = NULL;
+  that->_sizeBuffer = 0;
+  // Start the workers, the sockets are closed on exec to avoid a 
+  // worker keeping the sockets of the previous ones open
+  for (int iWorker = 0; iWorker < nbWorker; ++iWorker) {
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0) {
+      GenAlgErr->_type = PBErrTypeIOError;
+      sprintf(GenAlgErr->_msg, "Can't create the socket of a worker");
+      PBErrCatch(GenAlgErr);
+    }
+    pid_t pid = fork();
+    if (pid < 0) {
+      GenAlgErr->_type = PBErrTypeOther;
+      sprintf(GenAlgErr->_msg, "Can't create the process of a worker");
+      PBErrCatch(GenAlgErr);
+    }
+    if (pid == 0) {
+      // In the worker the socket becomes the standard input, if the 
+      // executable can't be run the pool sees the worker as failed
+      if (dup2(fds[1], STDIN_FILENO) != -1)
+        execl(path, path, (char*)NULL);
+      _exit(127);
+    }
+    close(fds[1]);
+    that->_workers[iWorker] = (GAWorker){
+      ._pid = pid, ._fd = fds[0], ._first = 0, ._nb = 0, 
+      ._deadline = 0};
+  }
+  // Return the new GAWorkerPool
+  return that;
 }
 
-// Load the history into the GAHistory 'that' from the FILE 'stream'
-// Return true if we could load the history, false else
-bool GAHistoryLoad(GAHistory* const that, FILE* const stream) {
+// Free the memory used by the GAWorkerPool 'that', its workers are 
+// stopped and waited for
+void GAWorkerPoolFree(GAWorkerPool** that) {
+  // Check the argument
+  if (that == NULL || *that == NULL) return;
+  // Stop the workers and wait for them
+  GAWorkerHead head = {0};
+  for (int iWorker = 0; iWorker < (*that)->_nbWorker; ++iWorker) {
+    GAWorker* worker = (*that)->_workers + iWorker;
+    if (worker->_fd != -1) {
+      GAWorkerWrite(worker->_fd, &head, sizeof(GAWorkerHead));
+      close(worker->_fd);
+    }
+    waitpid(worker->_pid, NULL, 0);
+  }
+  // Free memory
+  free((*that)->_workers);
+  free((*that)->_buffer);
+  free(*that);
+  *that = NULL;
+}
+
+// Evaluate the new GenAlgAdn of the GenAlg 'ga' with the workers of 
+// the GAWorkerPool 'that'
+// The candidates are spread over the workers in requests of at most
+// GAWorkerPoolGetMaxBatch candidates, and a worker receives a new 
+// request as soon as it has replied
+// The values are set with GASetAdnValue once all the evaluations are
+// done, in the same order as GAEvaluate
+// Return false and set no value if a worker has failed, i.e. closed
+// the connection or didn't reply within GAWorkerPoolGetTimeout, the
+// failed workers are killed and not used anymore
+bool GAWorkerPoolEvaluate(GAWorkerPool* const that, GenAlg* const ga) {
 #if BUILDMODE == 0
   if (that == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
     sprintf(GenAlgErr->_msg, "'that' is null");
     PBErrCatch(GenAlgErr);
   }
-  if (stream == NULL) {
+  if (ga == NULL) {
     GenAlgErr->_type = PBErrTypeNullPointer;
-    sprintf(GenAlgErr->_msg, "'stream' is null");
+    sprintf(GenAlgErr->_msg, "'ga' is null");
     PBErrCatch(GenAlgErr);
   }
 #endif
-  // Declare a json to load the encoded data
-  JSONNode* json = JSONCreate();
-  // Load the whole encoded data
-  if (!JSONLoad(json, stream)) {
-    return false;
-  }
-  // Decode the data from the JSON
-  if (!GAHistoryDecodeAsJSON(that, json)) {
-    return false;
+  // Gather the adns needing an evaluation
+  int nbAdn = GAGetNbAdns(ga);
+  GenAlgAdn** adns = PBErrMalloc(GenAlgErr, sizeof(GenAlgAdn*) * nbAdn);
+  float* vals = PBErrMalloc(GenAlgErr, sizeof(float) * nbAdn);
+  long nbTask = 0;
+  for (int iAdn = 0; iAdn < nbAdn; ++iAdn) {
+    GenAlgAdn* adn = GAAdn(ga, iAdn);
+    if (GAAdnIsNew(adn))
+      adns[nbTask++] = adn;
+  }
+  // Spread the candidates evenly over the remaining workers
+  int nbAlive = 0;
+  for (int iWorker = that->_nbWorker; iWorker--;)
+    if (that->_workers[iWorker]._fd != -1)
+      ++nbAlive;
+  bool ret = (nbAlive > 0 || nbTask == 0);
+  long sizeBatch = (nbAlive > 0 ? (nbTask + nbAlive - 1) / nbAlive : 0);
+  if (sizeBatch > that->_maxBatch)
+    sizeBatch = that->_maxBatch;
+  struct pollfd* fds = 
+    PBErrMalloc(GenAlgErr, sizeof(struct pollfd) * that->_nbWorker);
+  int* iWorkers = PBErrMalloc(GenAlgErr, sizeof(int) * that->_nbWorker);
+  long next = 0;
+  int nbBusy = 0;
+  while (true) {
+    // Send a request to the idle workers, unless a worker has failed
+    for (int iWorker = 0; ret && next < nbTask && 
+      iWorker < that->_nbWorker; ++iWorker) {
+      GAWorker* worker = that->_workers + iWorker;
+      if (worker->_fd == -1 || worker->_nb > 0)
+        continue;
+      long nb = MIN(sizeBatch, nbTask - next);
+      if (GAWorkerPoolSend(that, iWorker, ga, adns + next, nb)) {
+        worker->_first = next;
+        worker->_nb = nb;
+        worker->_deadline = GAWorkerPoolGetTime() + that->_timeout;
+        next += nb;
+        ++nbBusy;
+      } else {
+        GAWorkerPoolFail(that, iWorker);
+        ret = false;
+      }
+    }
+    if (nbBusy == 0)
+      break;
+    // Wait for the replies, at most until the earliest deadline
+    int nbFd = 0;
+    int timeout = -1;
+    long now = GAWorkerPoolGetTime();
+    for (int iWorker = 0; iWorker < that->_nbWorker; ++iWorker) {
+      GAWorker* worker = that->_workers + iWorker;
+      if (worker->_nb > 0) {
+        fds[nbFd] = (struct pollfd){.fd = worker->_fd, .events = POLLIN};
+        iWorkers[nbFd++] = iWorker;
+        if (that->_timeout >= 0) {
+          long left = MAX(worker->_deadline - now, 0);
+          if (timeout == -1 || left < timeout)
+            timeout = (int)left;
+        }
+      }
+    }
+    if (poll(fds, nbFd, timeout) < 0) {
+      if (errno == EINTR)
+        continue;
+      GenAlgErr->_type = PBErrTypeIOError;
+      sprintf(GenAlgErr->_msg, "poll failed");
+      PBErrCatch(GenAlgErr);
+    }
+    // Receive the values of the workers who replied, the ones who 
+    // didn't reply before their deadline have failed
+    now = GAWorkerPoolGetTime();
+    for (int iFd = 0; iFd < nbFd; ++iFd) {
+      GAWorker* worker = that->_workers + iWorkers[iFd];
+      if (fds[iFd].revents == 0) {
+        if (that->_timeout >= 0 && now >= worker->_deadline) {
+          GAWorkerPoolFail(that, iWorkers[iFd]);
+          ret = false;
+          --nbBusy;
+        }
+        continue;
+      }
+      GAWorkerHead head;
+      if (GAWorkerRead(worker->_fd, &head, sizeof(GAWorkerHead)) && 
+        head._nb == worker->_nb &&
+        GAWorkerRead(worker->_fd, vals + worker->_first, 
+        sizeof(float) * worker->_nb)) {
+        worker->_nb = 0;
+      } else {
+        GAWorkerPoolFail(that, iWorkers[iFd]);
+        ret = false;
+      }
+      --nbBusy;
+    }
   }
-  // Free the memory used by the JSON
-  JSONFree(&json);
+  // Set the values in one pass
+  if (ret)
+    for (long iTask = 0; iTask < nbTask; ++iTask)
+      GASetAdnValue(ga, adns[iTask], vals[iTask]);
+  // Free memory
+  free(adns);
+  free(vals);
+  free(fds);
+  free(iWorkers);
   // Return the success code
-  return true;
+  return ret;
 }
 
-// Function which decode from JSON encoding 'json' to GAHistory 'that'
-bool GAHistoryDecodeAsJSON(GAHistory* const that,
-  const JSONNode* const json) {
+// Serve the requests of a GAWorkerPool received on the socket 'fd', 
+// evaluating the candidates with the function 'fun' and the user 
+// data 'data', until the pool stops the worker
+// To be called by the executable of the workers with STDIN_FILENO
+// Return true if the worker has been stopped by the pool, false if
+// the connection failed
+bool GAWorkerServe(const int fd, const GAWorkerFun fun, 
+  void* const data) {
 #if BUILDMODE == 0
-  if (that == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'that' is null");
-    PBErrCatch(PBMathErr);
-  }
-  if (json == NULL) {
-    PBMathErr->_type = PBErrTypeNullPointer;
-    sprintf(PBMathErr->_msg, "'json' is null");
-    PBErrCatch(PBMathErr);
+  if (fun == NULL) {
+    GenAlgErr->_type = PBErrTypeNullPointer;
+    sprintf(GenAlgErr->_msg, "'fun' is null");
+    PBErrCatch(GenAlgErr);
   }
 #endif
-  // Flush the history
-  GAHistoryFlush(that);
-  // Decode the genealogy
-  JSONNode* propGen = JSONProperty(json, "_genealogy");
-  if (propGen == NULL) {
-    return false;
-  }
-  // Loop on the births
-  for (int i = 0; i < JSONGetNbValue(propGen); ++i) {
-    JSONNode* val = JSONValue(propGen, i);
-    // Decode the epoch
-    JSONNode* prop = JSONProperty(val, "_epoch");
-    if (prop == NULL) {
-      return false;
+  // The genes are received in 'request', the reply is built in 
+  // 'reply', both are kept from one request to the next
+  char* request = NULL;
+  size_t sizeRequest = 0;
+  char* reply = NULL;
+  size_t sizeReply = 0;
+  bool ret = false;
+  GAWorkerHead head;
+  while (GAWorkerRead(fd, &head, sizeof(GAWorkerHead))) {
+    if (head._nb == 0) {
+      ret = true;
+      break;
     }
-    long epoch = atol(JSONLblVal(prop));
-    // Decode the father
-    prop = JSONProperty(val, "_father");
-    if (prop == NULL) {
-      return false;
+    size_t sizeAdnI = sizeof(long) * head._nb * head._lengthAdnI;
+    size_t sizeAdnF = sizeof(float) * head._nb * head._lengthAdnF;
+    size_t size = sizeof(GAWorkerHead) + sizeof(float) * head._nb;
+    if (sizeRequest < sizeAdnI + sizeAdnF) {
+      sizeRequest = sizeAdnI + sizeAdnF;
+      request = realloc(request, sizeRequest);
+      if (request == NULL) {
+        GenAlgErr->_type = PBErrTypeNullPointer;
+        sprintf(GenAlgErr->_msg, "realloc failed");
+        PBErrCatch(GenAlgErr);
+      }
     }
-    long father = atol(JSONLblVal(prop));
-    // Decode the epoch
-    prop = JSONProperty(val, "_mother");
-    if (prop == NULL) {
-      return false;
+    if (sizeReply < size) {
+      sizeReply = size;
+      reply = realloc(reply, sizeReply);
+      if (reply == NULL) {
+        GenAlgErr->_type = PBErrTypeNullPointer;
+        sprintf(GenAlgErr->_msg, "realloc failed");
+        PBErrCatch(GenAlgErr);
+      }
     }
-    long mother = atol(JSONLblVal(prop));
-    // Decode the id
-    prop = JSONProperty(val, "_id");
-    if (prop == NULL) {
-      return false;
+    if (GAWorkerRead(fd, request, sizeAdnI + sizeAdnF) == false)
+      break;
+    // Evaluate the candidates, the int genes come first to keep them
+    // aligned
+    const long* adnI = (const long*)request;
+    const float* adnF = (const float*)(request + sizeAdnI);
+    memcpy(reply, &head, sizeof(GAWorkerHead));
+    for (uint32_t iCandidate = 0; iCandidate < head._nb; ++iCandidate) {
+      float val = fun(adnF + iCandidate * head._lengthAdnF, 
+        head._lengthAdnF, adnI + iCandidate * head._lengthAdnI, 
+        head._lengthAdnI, data);
+      memcpy(reply + sizeof(GAWorkerHead) + sizeof(float) * iCandidate,
+        &val, sizeof(float));
     }
-    GenAlgAdn adn;
-    adn._id = atol(JSONLblVal(prop));
-    adn._idParents[0] = father;
-    adn._idParents[1] = mother;
-    // Add the birth to history
-    GAHistoryRecordBirth(that, &adn, epoch);
+    if (GAWorkerWrite(fd, reply, size) == false)
+      break;
   }
+  // Free memory
+  free(request);
+  free(reply);
   // Return the success code
+  return ret;
+}
+
+// Write the 'size' bytes 'buffer' on the socket 'fd'
+// Return false if the connection failed
+bool GAWorkerWrite(const int fd, const void* const buffer, 
+  const size_t size) {
+  size_t done = 0;
+  while (done < size) {
+    // MSG_NOSIGNAL avoids the SIGPIPE if the other end has exited
+    ssize_t nb = 
+      send(fd, (const char*)buffer + done, size - done, MSG_NOSIGNAL);
+    if (nb < 0 && errno == EINTR)
+      continue;
+    if (nb <= 0)
+      return false;
+    done += (size_t)nb;
+  }
+  return true;
+}
+
+// Read 'size' bytes from the socket 'fd' into 'buffer'
+// Return false if the connection failed
+bool GAWorkerRead(const int fd, void* const buffer, const size_t size) {
+  size_t done = 0;
+  while (done < size) {
+    ssize_t nb = recv(fd, (char*)buffer + done, size - done, 0);
+    if (nb < 0 && errno == EINTR)
+      continue;
+    if (nb <= 0)
+      return false;
+    done += (size_t)nb;
+  }
   return true;
 }
 
+// Ensure the buffer of the GAWorkerPool 'that' can hold 'size' bytes
+void GAWorkerPoolReserve(GAWorkerPool* const that, const size_t size) {
+  if (that->_sizeBuffer < size) {
+    that->_buffer = realloc(that->_buffer, size);
+    if (that->_buffer == NULL) {
+      GenAlgErr->_type = PBErrTypeNullPointer;
+      sprintf(GenAlgErr->_msg, "realloc failed");
+      PBErrCatch(GenAlgErr);
+    }
+    that->_sizeBuffer = size;
+  }
+}
+
+// Send the 'nb' candidates 'adns' of the GenAlg 'ga' to the 
+// 'iWorker'-th worker of the GAWorkerPool 'that'
+// Return false if the connection failed
+bool GAWorkerPoolSend(GAWorkerPool* const that, const int iWorker,
+  const GenAlg* const ga, GenAlgAdn** const adns, const long nb) {
+  GAWorkerHead head = {
+    ._nb = (uint32_t)nb, 
+    ._lengthAdnF = (uint32_t)GAGetLengthAdnFloat(ga), 
+    ._lengthAdnI = (uint32_t)GAGetLengthAdnInt(ga)};
+  size_t sizeAdnI = sizeof(long) * head._lengthAdnI;
+  size_t sizeAdnF = sizeof(float) * head._lengthAdnF;
+  GAWorkerPoolReserve(that, 
+    sizeof(GAWorkerHead) + (sizeAdnI + sizeAdnF) * nb);
+  // Pack the message in one buffer to send it in one call
+  char* ptr = that->_buffer;
+  memcpy(ptr, &head, sizeof(GAWorkerHead));
+  ptr += sizeof(GAWorkerHead);
+  if (sizeAdnI > 0)
+    for (long iCandidate = 0; iCandidate < nb; ++iCandidate) {
+      memcpy(ptr, GAAdnAdnI(adns[iCandidate])->_val, sizeAdnI);
+      ptr += sizeAdnI;
+    }
+  if (sizeAdnF > 0)
+    for (long iCandidate = 0; iCandidate < nb; ++iCandidate) {
+      memcpy(ptr, GAAdnAdnF(adns[iCandidate])->_val, sizeAdnF);
+      ptr += sizeAdnF;
+    }
+  return GAWorkerWrite(that->_workers[iWorker]._fd, that->_buffer, 
+    (size_t)(ptr - that->_buffer));
+}
+
+// Close the connection to the failed 'iWorker'-th worker of the 
+// GAWorkerPool 'that' and kill it
+void GAWorkerPoolFail(GAWorkerPool* const that, const int iWorker) {
+  GAWorker* worker = that->_workers + iWorker;
+  close(worker->_fd);
+  worker->_fd = -1;
+  worker->_nb = 0;
+  // Kill the worker in case it hangs, GAWorkerPoolFree would 
+  // otherwise wait for it forever
+  kill(worker->_pid, SIGKILL);
+}
+
+// Return the current time in ms of the monotonic clock
+long GAWorkerPoolGetTime(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
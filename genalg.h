@@ -10,6 +10,13 @@
 #include <math.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <float.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
 #include "pberr.h"
 #include "pbmath.h"
 #include "gset.h"
@@ -23,6 +30,33 @@
 #define GENALG_NBENTITIES 100
 #define GENALG_NBELITES 20
 
+// Alignment in bytes of the rows in the contiguous store of adns
+#define GENALG_STORE_ALIGN 64
+
+// Number of genes processed per block by the mutation kernel
+#define GENALG_MUTE_BLOCK 256
+// Probability of mutation below which the mutating genes are sampled
+// directly instead of testing each gene
+#define GENALG_MUTE_SPARSE_PROB 0.1
+
+// Magic string and version of the binary snapshots of GenAlg
+#define GENALG_SNAPSHOT_MAGIC "GENALGB"
+#define GENALG_SNAPSHOT_VERSION 1
+// Magic string of the delta checkpoints of GenAlg
+#define GENALG_DELTA_MAGIC "GENALGD"
+// Magic string and version of the binary genealogy logs of GenAlg
+#define GENALG_HISTORY_MAGIC "GENALGH"
+#define GENALG_HISTORY_VERSION 1
+// Number of births buffered in memory before being appended to the 
+// genealogy log
+#define GENALG_HISTORY_BUFFER 4096
+// Number of births per chunk of the arena storing the genealogy of a 
+// GAHistory
+#define GENALG_HISTORY_CHUNK 4096
+// Maximum number of bytes waiting to be written by a GAIOWriter, 
+// above which the saving thread waits for the writer
+#define GENALG_IO_MAXQUEUE 67108864
+
 #define GENALG_TXTOMETER_NBADNDISPLAYED 40
 #define GENALG_TXTOMETER_LINE1 "Epoch #xxxxxx  KTEvent #xxxxxx  \n"
 #define GENALG_TXTOMETER_FORMAT1 "Epoch #%06lu  KTEvent #%06lu\n"
@@ -35,6 +69,30 @@
 #define GENALG_TXTOMETER_LINE6 "Size pool xxxxxx                \n"
 #define GENALG_TXTOMETER_FORMAT6 "Size pool %06d  \n"
 
+// ------------- GARng
+
+// ================= Data structure ===================
+
+// Pseudo random generator (xoshiro128+)
+// Generators created with the same seed and different streams 
+// produce independent sequences
+typedef struct GARng {
+  // State of the generator
+  uint32_t _s[4];
+} GARng;
+
+// ================ Functions declaration ====================
+
+// Return a new GARng for the stream 'stream' of the seed 'seed'
+GARng GARngCreateStatic(const unsigned long seed, 
+  const unsigned long stream);
+
+// Return a random value in [0.0, 1.0[ from the GARng 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+float GARngUnif(GARng* const that);
+
 // ------------- GenAlgAdn
 
 // ================= Data structure ===================
@@ -60,6 +118,19 @@ typedef struct GenAlgAdn {
   VecFloat* _mutabilityF;
   // Mutability of adn for integer value
   VecFloat* _mutabilityI;
+  // Index of the row of this adn in the contiguous store of its 
+  // GenAlg, -1 if the adn owns its vectors
+  long _iRow;
+  // Rank of this adn at the last update of the rank index of its 
+  // GenAlg, -1 if the adn is not in a GenAlg
+  int _rank;
+  // Flag set if the value of this adn has been found in the fitness 
+  // cache of its GenAlg, in which case it doesn't need an evaluation
+  bool _flagCachedVal;
+  // Flag set if the evaluation of this adn has been aborted by 
+  // GAEvaluateRace, in which case its value is an upper bound of its
+  // actual value
+  bool _flagPartialVal;
 } GenAlgAdn;
 
 // ================ Functions declaration ====================
@@ -92,12 +163,14 @@ static inline
 VecLong* GAAdnAdnI(const GenAlgAdn* const that);
 
 // Initialise randomly the genes of the GenAlgAdn 'that' of the 
-// GenAlg 'ga' according to the type of the GenAlg
-void GAAdnInit(GenAlgAdn* const that, const GenAlg* ga);
+// GenAlg 'ga' according to the type of the GenAlg, using the random
+// generator of 'ga'
+void GAAdnInit(GenAlgAdn* const that, GenAlg* const ga);
 
 // Initialise randomly the genes of the GenAlgAdn 'that' of the 
 // GenAlg 'ga', version used to calculate the parameters of a NeuraNet
-void GAAdnInitNeuraNet(const GenAlgAdn* const that, const GenAlg* ga);
+void GAAdnInitNeuraNet(const GenAlgAdn* const that, const GenAlg* ga,
+  GARng* const rng);
 
 // Get the 'iGene'-th gene of the adn for floating point values of the
 // GenAlgAdn 'that'
@@ -167,12 +240,25 @@ float GAAdnGetVal(const GenAlgAdn* const that);
 void GAAdnPrintln(const GenAlgAdn* const that, FILE* const stream);
 
 // Return true if the GenAlgAdn 'that' is new, i.e. is age equals 1
+// and its value has not been found in the fitness cache of its 
+// GenAlg
 // Return false
 #if BUILDMODE != 0
 static inline
 #endif
 bool GAAdnIsNew(const GenAlgAdn* const that);
 
+// Return true if the evaluation of the GenAlgAdn 'that' has been 
+// aborted by GAEvaluateRace, its value is then only an upper bound of
+// its actual value
+// The flag is not saved: GASave, GASaveBinary and the checkpoints 
+// save the upper bound as the value of the adn. The aborted adns are 
+// not recorded in the fitness cache
+#if BUILDMODE != 0
+static inline
+#endif
+bool GAAdnIsPartial(const GenAlgAdn* const that);
+
 // Copy the GenAlgAdn 'tho' into the GenAlgAdn 'that'
 #if BUILDMODE != 0
 static inline
@@ -223,6 +309,40 @@ typedef struct GAMorpheus {
   const VecLong* _links;
 } GAMorpheus;
 
+// Data waiting to be written by a GAIOWriter
+typedef struct GAIOJob {
+  // Data, owned by the job
+  char* _data;
+  // Size of the data in bytes
+  size_t _size;
+  // Stream where the data is written
+  FILE* _stream;
+  // Next job in the queue
+  struct GAIOJob* _next;
+} GAIOJob;
+
+// Thread writing in background the data saved by a GenAlg, in the 
+// order they have been saved
+typedef struct GAIOWriter {
+  // Writer thread
+  pthread_t _thread;
+  // Synchronisation with the writer thread
+  pthread_mutex_t _mutex;
+  pthread_cond_t _condJob;
+  pthread_cond_t _condDone;
+  // Queue of jobs
+  GAIOJob* _first;
+  GAIOJob* _last;
+  // Number of bytes in the queue and in the job being written
+  size_t _sizeQueued;
+  // Flag to remember if the writer thread is writing a job
+  bool _flagBusy;
+  // Flag to remember if a write has failed
+  bool _flagError;
+  // Flag to stop the writer thread
+  bool _flagStop;
+} GAIOWriter;
+
 // Structures to save the history of the GenAlg
 typedef struct GAHistoryBirth {
   // Epoch
@@ -232,13 +352,350 @@ typedef struct GAHistoryBirth {
   // Child
   unsigned long _idChild;
 } GAHistoryBirth;
+// Node of a GAGenealogy, one per adn
+typedef struct GAGenealogyNode {
+  // Birth of the adn
+  GAHistoryBirth _birth;
+  // Indices of the nodes of the parents, -1 if the parent is not in 
+  // the genealogy (the adns created by GAInit are their own parents)
+  long _parents[2];
+  // Index in '_links' of the first link to the children, -1 if none
+  long _firstChild;
+  // Number of generations between the adn and its oldest ancestor
+  long _depth;
+  // Stamp of the last traversal which visited the node
+  unsigned long _stamp;
+} GAGenealogyNode;
+// Link from a GAGenealogyNode to one of its children
+typedef struct GAGenealogyLink {
+  // Index of the node of the child
+  long _child;
+  // Index of the next link of the same parent, -1 if none
+  long _next;
+} GAGenealogyLink;
+// Index of a genealogy for ancestry queries
+typedef struct GAGenealogy {
+  // Nodes, in the order of the births
+  GAGenealogyNode* _nodes;
+  long _nbNode;
+  long _nbMaxNode;
+  // Links from the parents to the children
+  GAGenealogyLink* _links;
+  long _nbLink;
+  long _nbMaxLink;
+  // Hash table (open addressing) from the id of the adns to the 
+  // index of their node, -1 for the empty slots
+  long* _slots;
+  // Number of slots, power of 2
+  long _nbSlot;
+  // Stamp of the current traversal
+  unsigned long _stamp;
+  // Result of the last traversal
+  unsigned long* _ids;
+} GAGenealogy;
+// Chunk of the arena storing the genealogy of a GAHistory
+typedef struct GAHistoryChunk {
+  // Next chunk
+  struct GAHistoryChunk* _next;
+  // Number of births used in the chunk
+  long _nb;
+  // Births, GENALG_HISTORY_CHUNK per chunk
+  GAHistoryBirth _births[];
+} GAHistoryChunk;
 typedef struct GAHistory {
-  // Set of GAHistoryBirth
-  GSet _genealogy;
+  // Chunks of GAHistoryBirth, filled by GAHistoryLoad
+  GAHistoryChunk* _genealogy;
+  // Last chunk, where the next birth is added
+  GAHistoryChunk* _lastChunk;
+  // Number of births in the genealogy
+  long _nbBirth;
   // Path to the history file
   char* _path;
+  // Ring buffer of the births not yet appended to the log, allocated 
+  // at the first recorded birth
+  GAHistoryBirth* _births;
+  // Size of '_births', GENALG_HISTORY_BUFFER unless it has grown 
+  // because the log couldn't be written
+  long _nbMaxPending;
+  // Index in '_births' of the oldest pending birth
+  long _iFirst;
+  // Number of pending births
+  long _nbPending;
+  // Flag set when the log couldn't be written while recording a 
+  // birth, reported and reset by GASaveHistory and GAWaitIO
+  bool _flagError;
+  // Stream of the log, NULL until the first write after a flush
+  FILE* _log;
+  // Writer of the GenAlg owning the history, NULL if the log is 
+  // written synchronously
+  GAIOWriter* _writer;
+  // Index of the genealogy, NULL if the births are not indexed
+  GAGenealogy* _index;
 } GAHistory;
 
+// Contiguous store for the genes of the adns of a GenAlg
+// Each slab contains '_nbRow' rows, each row starts with the header
+// of a VecFloat or VecLong followed by the genes, so the GenAlgAdn 
+// can use its vectors as views inside the slabs
+typedef struct GAAdnStore {
+  // Slabs for the adn, delta adn and mutability for floating 
+  // point values
+  char* _adnF;
+  char* _deltaAdnF;
+  char* _mutabilityF;
+  // Slabs for the adn and mutability for integer values
+  char* _adnI;
+  char* _mutabilityI;
+  // Size in bytes of one row of the slabs for floating point values
+  size_t _strideF;
+  // Size in bytes of one row of the slab of adn for integer values
+  size_t _strideI;
+  // Size in bytes of one row of the slab of mutability for integer 
+  // values
+  size_t _strideMutI;
+  // Number of rows in the slabs
+  long _nbRow;
+  // Stack of the indices of unused rows
+  long* _freeRows;
+  // Number of unused rows
+  long _nbFreeRow;
+} GAAdnStore;
+
+// Function executed by a GAThreadPool for the task 'iTask' on the 
+// data 'data', 'iThread' is the index of the thread executing it
+typedef void (*GAThreadPoolFun)(void* const data, const long iTask, 
+  const int iThread);
+
+// Persistent pool of worker threads
+// The thread calling GAThreadPoolRun works as the thread of index 0,
+// the workers have indices 1 to '_nbThread' - 1
+typedef struct GAThreadPool {
+  // Total number of threads, including the calling thread
+  int _nbThread;
+  // Worker threads
+  pthread_t* _threads;
+  // Counter used by the workers to get their index at start up
+  atomic_int _nbStarted;
+  // Synchronisation of the workers
+  pthread_mutex_t _mutex;
+  pthread_cond_t _condStart;
+  pthread_cond_t _condEnd;
+  // Counter of the runs, used by the workers to detect a new run
+  unsigned long _run;
+  // Number of workers still working on the current run
+  int _nbBusy;
+  // Flag to stop the workers
+  bool _flagStop;
+  // Current job
+  GAThreadPoolFun _fun;
+  void* _data;
+  long _nbTask;
+  // Index of the next task to be executed in the current job
+  atomic_long _nextTask;
+} GAThreadPool;
+
+// Function evaluating the GenAlgAdn 'adn' with the user data 
+// 'data' and returning its value, 'iThread' is the index of the 
+// thread calling the function
+typedef float (*GAEvalFun)(const GenAlgAdn* const adn, 
+  void* const data, const int iThread);
+
+// Function returning the sum of the values of the GenAlgAdn 'adn' for
+// the 'nbCase' test cases starting at the 'iCase'-th one, with the 
+// user data 'data', 'iThread' is the index of the thread calling the
+// function
+typedef float (*GARaceFun)(const GenAlgAdn* const adn, 
+  const long iCase, const long nbCase, void* const data, 
+  const int iThread);
+
+// Matrix of the diversity between each pair of elites, updated 
+// incrementally: each elite occupies a slot of the matrix as long 
+// as it stays an elite, and only the slots of the new elites are 
+// recalculated
+typedef struct GAEliteDiversity {
+  // Number of slots
+  int _nb;
+  // Diversity between the elites in slots i and j at 
+  // _div[i * _nb + j]
+  float* _div;
+  // Id of the adn in each slot
+  unsigned long* _ids;
+  // Flag for each slot, true if its diversities are up to date
+  bool* _flagUpToDate;
+  // Adn in each slot during the update
+  const GenAlgAdn** _adns;
+  // New elites without slot during the update
+  const GenAlgAdn** _newAdns;
+  // Number of slots recalculated during the last update
+  int _nbUpdated;
+  // Average and minimum diversity over the pairs of elites
+  float _avg;
+  float _min;
+} GAEliteDiversity;
+
+// Bounded cache of the values of the adns, indexed by the hash of 
+// their genes, the least recently used entry being replaced when 
+// the cache is full
+typedef struct GAFitnessCache {
+  // Maximum number of entries, 0 if the cache is disabled
+  int _nbMax;
+  // Number of entries
+  int _nb;
+  // Number of genes for floating point and integer values
+  long _lengthF;
+  long _lengthI;
+  // Hash table: index of the first entry of each bucket, -1 if the 
+  // bucket is empty, the number of buckets is a power of 2
+  int* _buckets;
+  long _maskBucket;
+  // Entries: hash, value, genes, index of the next entry in the same
+  // bucket, and indices of the previous and next entries in the 
+  // order of use (from '_head' the most recently used to '_tail' 
+  // the least recently used)
+  uint64_t* _hashes;
+  float* _vals;
+  float* _genesF;
+  long* _genesI;
+  int* _nextInBucket;
+  int* _prev;
+  int* _next;
+  int _head;
+  int _tail;
+  // Number of children found and not found in the cache
+  unsigned long _nbHit;
+  unsigned long _nbMiss;
+} GAFitnessCache;
+
+// Memory of the last checkpoint of a GenAlg, used to write only the 
+// adns which have changed since then
+typedef struct GACheckpoint {
+  // Sorted ids of the adns of the population at the last checkpoint
+  unsigned long* _ids;
+  // Number of ids, 0 if the next checkpoint must be a full snapshot
+  long _nb;
+  // Size of the array '_ids'
+  long _nbMax;
+  // Id of the best adn at the last checkpoint
+  unsigned long _idBest;
+} GACheckpoint;
+
+// Scratch memory of one thread for the temporaries of the genetic 
+// operators, reused from one child to the next
+typedef struct GAScratch {
+  // Flags of the input and hidden values used by the links of a 
+  // child (GAMuteNeuraNet)
+  char* _isUsed;
+  // Size of the array '_isUsed'
+  long _nbIsUsed;
+} GAScratch;
+
+// Data of the steady state mode, where the children are created one 
+// by one on demand and inserted in the population as soon as they are
+// evaluated
+typedef struct GASteadyState {
+  // Mutex protecting the GenAlg in GAGetSteadyChild and 
+  // GASetSteadyChildValue
+  pthread_mutex_t _mutex;
+  // Children given back by GASetSteadyChildValue, reused by 
+  // GAGetSteadyChild
+  GSet _spares;
+  // Number of children created, used to cycle through the ranks of 
+  // the non elite adns for the probability of mutation
+  unsigned long _nbAsked;
+  // Number of children evaluated during the current epoch
+  long _nbTold;
+  // Number of adns killed by the last KT event and not replaced yet
+  int _nbDead;
+  // Flag memorizing if the best adn has improved during the current 
+  // epoch
+  bool _flagImprov;
+} GASteadyState;
+
+// Batch of candidates given by GAAsk, to be evaluated and given back
+// with GATell
+typedef struct GABatch {
+  // Number of candidates
+  long _nb;
+  // Ids of the candidates
+  unsigned long* _ids;
+  // Genes for floating point values of the candidates, one candidate 
+  // after the other
+  float* _adnF;
+  // Genes for integer values of the candidates, one candidate after 
+  // the other
+  long* _adnI;
+  // Length of the genes for floating point values
+  long _lengthAdnF;
+  // Length of the genes for integer values
+  long _lengthAdnI;
+  // Generation of the ask/tell state when the batch was given
+  unsigned long _generation;
+  // Adns of the candidates
+  GenAlgAdn** _adns;
+} GABatch;
+
+// State of the ask/tell interface of a GenAlg
+typedef struct GAAskTell {
+  // Mutex protecting the GenAlg in GAAsk and GATell
+  pthread_mutex_t _mutex;
+  // New adns of the current epoch not given by GAAsk yet
+  GenAlgAdn** _toAsk;
+  // Number of adns in '_toAsk'
+  long _nbToAsk;
+  // Size of the array '_toAsk'
+  long _nbMaxToAsk;
+  // Number of new adns of the current epoch without value yet
+  long _nbToTell;
+  // Flag memorizing if the new adns of the current epoch have been 
+  // gathered
+  bool _flagGathered;
+  // Generation of the state, incremented each time the population 
+  // changes (GAStep, GAInit) and never reset, to recognize the 
+  // batches given before the change
+  unsigned long _generation;
+} GAAskTell;
+
+// Genes of a set of candidates stored as matrices with one row per 
+// gene and one column per candidate, for evaluation functions 
+// vectorized over the candidates
+typedef struct GAGenesMatrix {
+  // Number of candidates
+  long _nb;
+  // Number of columns of the matrices, '_nb' rounded up so that each
+  // row starts on GENALG_STORE_ALIGN bytes, the extra columns are 
+  // null
+  long _stride;
+  // Length of the genes for floating point values
+  long _lengthAdnF;
+  // Length of the genes for integer values
+  long _lengthAdnI;
+  // Genes for floating point values, the 'iGene'-th gene of the 
+  // 'iCandidate'-th candidate is _adnF[iGene * _stride + iCandidate]
+  float* _adnF;
+  // Genes for integer values, same layout as '_adnF'
+  long* _adnI;
+  // Values of the candidates, '_stride' values
+  float* _scores;
+  // Number of columns the memory has been allocated for
+  long _nbMaxStride;
+} GAGenesMatrix;
+
+// Function evaluating all the candidates of the GAGenesMatrix 'genes'
+// with the user data 'data' in one call, the value of the 
+// 'iCandidate'-th candidate must be set in 'scores[iCandidate]'
+typedef void (*GAMatrixEvalFun)(const GAGenesMatrix* const genes, 
+  float* const scores, void* const data);
+
+// Score of an adn used by the partial selection of the best adns
+typedef struct GASelectItem {
+  // Value of the adn
+  float _val;
+  // Position of the adn in the GSet of adns, from the head
+  long _pos;
+  // The adn
+  GenAlgAdn* _adn;
+} GASelectItem;
+
 typedef struct GenAlg {
   // GSet of GenAlgAdn, sortval == score so the head of the set is the 
   // worst adn and the tail of the set is the best
@@ -249,6 +706,10 @@ typedef struct GenAlg {
   GenAlgType _type;
   // Current epoch
   unsigned long _curEpoch;
+  // Seed of the random generators
+  unsigned long _seed;
+  // Random generator used by the sequential operations
+  GARng _rng;
   // Nb elite entities in population
   int _nbElites;
   // Id of the next new GenAlgAdn
@@ -261,6 +722,10 @@ typedef struct GenAlg {
   VecFloat2D* _boundsF;
   // Bounds (min, max) for integer values adn
   VecLong2D* _boundsI;
+  // Flat copies of the min and max bounds for floating point values 
+  // adn (optimization for the mutation)
+  float* _boundsMinF;
+  float* _boundsMaxF;
   // Norm of the range value for adns (optimization for diversity
   // calculation)
   float _normRangeFloat;
@@ -292,6 +757,44 @@ typedef struct GenAlg {
   bool _flagHistory;
   // Maximum age for an entity
   unsigned long _maxAge;
+  // Contiguous store of the adns' genes, NULL if each adn owns 
+  // its vectors
+  GAAdnStore* _store;
+  // Elements of '_adns' indexed by rank (0 is the best adn), kept
+  // coherent with the order of '_adns'
+  GSetElem** _ranks;
+  // Size of the array '_ranks'
+  int _nbMaxRank;
+  // Scores of the adns used by GASelectBest
+  GASelectItem* _selection;
+  // Size of the array '_selection'
+  int _nbMaxSelection;
+  // Scratch memory of the threads executing GAStep, indexed by thread
+  GAScratch* _scratch;
+  // Size of the array '_scratch'
+  int _nbScratch;
+  // Data of the steady state mode, NULL in generational mode
+  GASteadyState* _steady;
+  // State of the ask/tell interface
+  GAAskTell _askTell;
+  // Genes of the candidates of GAEvaluateMatrix, kept from one call
+  // to the next
+  GAGenesMatrix _matrix;
+  // Pool of threads used for parallel operations, NULL until needed
+  GAThreadPool* _pool;
+  // Number of threads used by GAStep
+  int _nbThread;
+  // Diversity between the elites
+  GAEliteDiversity _eliteDiversity;
+  // Flag to remember if the KT event is triggered by the diversity
+  // between the elites' genes instead of their values
+  bool _flagEliteDiversity;
+  // Cache of the values of the adns
+  GAFitnessCache _fitnessCache;
+  // Memory of the last checkpoint
+  GACheckpoint _checkpoint;
+  // Writer thread used in asynchronous mode, NULL in synchronous mode
+  GAIOWriter* _writer;
 } GenAlg;
 
 // ================ Functions declaration ====================
@@ -402,6 +905,16 @@ static inline
 #endif
 unsigned long GAGetCurEpoch(const GenAlg* const that);
 
+// Set the seed of the random generators of the GenAlg 'that' to 
+// 'seed' and reset its generator
+void GASetSeed(GenAlg* const that, const unsigned long seed);
+
+// Return the seed of the random generators of the GenAlg 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+unsigned long GAGetSeed(const GenAlg* const that);
+
 // Return the number of KTEvent of the GenAlg 'that'
 #if BUILDMODE != 0
 static inline
@@ -467,10 +980,22 @@ static inline
 #endif
 GenAlgAdn* GAAdn(const GenAlg* const that, const int iRank);
 
+// Update the rank index of the GenAlg 'that' from the current order 
+// of its GSet of adns
+// Must be called if the GSet of adns is modified by the user
+void GAUpdateRanks(GenAlg* const that);
+
+// Reorder the GSet of adns of the GenAlg 'that' such as its 'nb' best
+// adns are sorted at its tail, the other adns being at its head in 
+// unspecified order, and update the rank index
+// The ranks lower than 'nb' are the same as after a full GSetSort, at 
+// the cost of a partial selection instead of a sort
+void GASelectBest(GenAlg* const that, const int nb);
+
 // Init the GenAlg 'that'
 // Must be called after the bounds have been set
-// The random generator must have been initialised before calling this
-// function
+// The genes are initialised with the random generator of the GenAlg,
+// use GASetSeed before calling this function for a reproducible run
 void GAInit(GenAlg* const that);
 
 // Step an epoch for the GenAlg 'that' with the current ranking of
@@ -491,6 +1016,93 @@ static inline
 #endif
 float GAGetDiversity(const GenAlg* const that);
 
+// Get the diversity value of 'adnA' against 'adnB' of the GenAlg 'ga'
+// The diversity is the euclidean distance between the genes 
+// normalised by the range of the genes, averaged over the genes for 
+// floating point and integer values
+float GAAdnGetDiversity(const GenAlgAdn* const adnA, 
+  const GenAlgAdn* const adnB, const GenAlg* const ga);
+
+// Get the diversity of the GenAlgAdn 'adn' against each elite of the 
+// GenAlg 'that'
+// The result is stored in 'diversities' which must be an array of 
+// at least GAGetNbElites(that) floats, the i-th value being the 
+// diversity against the elite of rank i
+void GAGetDiversityToElites(const GenAlg* const that, 
+  const GenAlgAdn* const adn, float* const diversities);
+
+// Update the matrix of diversity between the elites of the GenAlg 
+// 'that'
+// Only the elites which were not elites at the previous update are 
+// recalculated, the elites are identified by their id
+void GAUpdateEliteDiversity(GenAlg* const that);
+
+// Invalidate the matrix of diversity between the elites of the 
+// GenAlg 'that' so that it is entirely recalculated at the next 
+// update
+// Must be called if the genes of the elites are modified by the user
+void GAResetEliteDiversity(GenAlg* const that);
+
+// Get the average diversity between the pairs of elites of the 
+// GenAlg 'that' at the last call of GAUpdateEliteDiversity
+#if BUILDMODE != 0
+static inline
+#endif
+float GAGetEliteDiversityAvg(const GenAlg* const that);
+
+// Get the minimum diversity between the pairs of elites of the 
+// GenAlg 'that' at the last call of GAUpdateEliteDiversity
+#if BUILDMODE != 0
+static inline
+#endif
+float GAGetEliteDiversityMin(const GenAlg* const that);
+
+// Set the maximum number of entries in the fitness cache of the 
+// GenAlg 'that' to 'nb' and empty the cache
+// If 'nb' is 0 (default) the cache is disabled. Else, GAStep records 
+// the values of the new adns in the cache and looks up the genes of 
+// each child: if an adn with the same genes has already been 
+// evaluated its value is reused and the child is not new (cf 
+// GAAdnIsNew). Only use the cache if the evaluation is deterministic
+void GASetFitnessCacheSize(GenAlg* const that, const int nb);
+
+// Get the maximum number of entries in the fitness cache of the 
+// GenAlg 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+int GAGetFitnessCacheSize(const GenAlg* const that);
+
+// Get the number of children of the GenAlg 'that' whose value has 
+// been found in the fitness cache
+#if BUILDMODE != 0
+static inline
+#endif
+unsigned long GAGetNbFitnessCacheHit(const GenAlg* const that);
+
+// Get the number of children of the GenAlg 'that' whose value has 
+// not been found in the fitness cache
+#if BUILDMODE != 0
+static inline
+#endif
+unsigned long GAGetNbFitnessCacheMiss(const GenAlg* const that);
+
+// Set the flag memorizing if the KT event of the GenAlg 'that' is 
+// triggered by the average diversity between the elites' genes 
+// (true) or by the difference of value between the last two elites 
+// (false, default) to 'flag'
+#if BUILDMODE != 0
+static inline
+#endif
+void GASetFlagEliteDiversity(GenAlg* const that, const bool flag);
+
+// Get the flag memorizing if the KT event of the GenAlg 'that' is 
+// triggered by the average diversity between the elites' genes
+#if BUILDMODE != 0
+static inline
+#endif
+bool GAGetFlagEliteDiversity(const GenAlg* const that);
+
 // Function which return the JSON encoding of 'that' 
 JSONNode* GAEncodeAsJSON(const GenAlg* const that);
 
@@ -505,10 +1117,88 @@ bool GALoad(GenAlg** that, FILE* const stream);
 // Save the GenAlg 'that' to the stream 'stream'
 // If 'compact' equals true it saves in compact form, else it saves in 
 // readable form
+// The encoding is the one of GAEncodeAsJSON but it is written 
+// progressively, without creating the JSONNode of the whole GenAlg
 // Return true in case of success, else false
 bool GASave(const GenAlg* const that, FILE* const stream, 
   const bool compact);
 
+// Save the GenAlg 'that' to the stream 'stream' as a binary snapshot
+// The snapshot is made of a header, the bounds, the id, age and value
+// of each adn, and the genes of all the adns as raw slabs. It uses 
+// the native endianness, use GASave to exchange between machines
+// Return true in case of success, else false
+bool GASaveBinary(const GenAlg* const that, FILE* const stream);
+
+// Load the GenAlg 'that' from the binary snapshot at the current 
+// position of the stream 'stream'
+// If the stream is a regular file it is memory mapped and the genes 
+// are copied directly from the mapping, else it is read
+// On success the stream is positioned after the snapshot
+// If the GenAlg is already allocated, it is freed before loading
+// Return true in case of success, else false
+bool GALoadBinary(GenAlg** that, FILE* const stream);
+
+// Append a checkpoint of the GenAlg 'that' to the stream 'stream'
+// The first checkpoint, and the first one after a call to 
+// GAResetCheckpoint, is a full binary snapshot (cf GASaveBinary). The
+// following ones are deltas which contain the id, age and value of 
+// every adn but the genes of only the adns which were not in the 
+// previous checkpoint
+// Return true in case of success, else false
+bool GASaveCheckpoint(GenAlg* const that, FILE* const stream);
+
+// Force the next checkpoint of the GenAlg 'that' to be a full binary
+// snapshot
+// It is automatically called when the genes are reinitialised by 
+// GAInit or the bounds are modified
+void GAResetCheckpoint(GenAlg* const that);
+
+// Load the GenAlg 'that' from the checkpoints in the seekable stream 
+// 'stream', i.e. the full snapshot at the current position and all 
+// the checkpoints after it until the end of the stream
+// The next checkpoint of the loaded GenAlg is a delta, so a run can 
+// be resumed by appending its checkpoints to the same stream
+// If the GenAlg is already allocated, it is freed before loading
+// Return true in case of success, else false
+bool GALoadCheckpoint(GenAlg** that, FILE* const stream);
+
+// Compact the checkpoints in the stream 'streamIn' into a single full 
+// binary snapshot written to the stream 'streamOut'
+// Return true in case of success, else false
+bool GACompactCheckpoint(FILE* const streamIn, FILE* const streamOut);
+
+// Set the asynchronous I/O flag of the GenAlg 'that'
+// In asynchronous mode GASaveHistory, GASaveCheckpoint and GASaveAsync
+// return as soon as the data to save is copied in memory, and the 
+// data is written by a background thread. The streams given to them 
+// must stay open until GAWaitIO has returned
+// Turning the flag off waits for the pending writes, a failure of 
+// these writes is reported by the next GAWaitIO or GASaveHistory
+void GASetFlagAsyncIO(GenAlg* const that, const bool flag);
+
+// Get the asynchronous I/O flag of the GenAlg 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+bool GAGetFlagAsyncIO(const GenAlg* const that);
+
+// Wait until all the data saved asynchronously by the GenAlg 'that' 
+// has been written
+// Return true if all the writes since the last call succeeded, false 
+// else, including if the history log couldn't be opened by GAStep
+// As the failed write may be a checkpoint, the next checkpoint after 
+// a failure is a full binary snapshot. The deltas saved between the 
+// failure and the call to GAWaitIO may not be loadable
+bool GAWaitIO(GenAlg* const that);
+
+// Save the GenAlg 'that' to the stream 'stream' as GASave, from the 
+// background thread if the GenAlg is in asynchronous mode
+// Return true in case of success, else false (in asynchronous mode, 
+// the failure of the write itself is reported by GAWaitIO)
+bool GASaveAsync(GenAlg* const that, FILE* const stream, 
+  const bool compact);
+
 // Set the value of the GenAlgAdn 'adn' of the GenAlg 'that' to 'val'
 #if BUILDMODE != 0
 static inline
@@ -568,6 +1258,8 @@ GAHistory GAHistoryCreateStatic(void);
 void GAHistoryFree(GAHistory* that);
 
 // Add a birth to the history of the GenAlg 'that'
+// The birth is buffered and the buffer is appended to the log when 
+// it is full
 #if BUILDMODE != 0
 static inline
 #endif
@@ -581,6 +1273,9 @@ static inline
 void GASetFlagHistory(GenAlg* const that, const bool flag);
 
 // Set the path where the history is recorded for the GenAlg 'that'
+// The history is a binary genealogy log (cf GASaveHistory), its 
+// default path is ./genAlgHistory.bin (./genAlgHistory.json before 
+// the history was saved as a binary log)
 #if BUILDMODE != 0
 static inline
 #endif
@@ -598,24 +1293,136 @@ static inline
 #endif
 bool GAGetFlagHistory(const GenAlg* const that);
 
-// Save the history of the GenAlg 'that'
-// Return true if we could save the history, false else
-bool GASaveHistory(const GenAlg* const that);
+// Save the history of the GenAlg 'that', i.e. append the births 
+// recorded since the last save to its binary genealogy log
+// The log is recreated by the first save after GAInit
+// Return true if we could save the history, false else, including if
+// the log couldn't be written by GAStep since the last call (the 
+// births are then kept until they can be written)
+bool GASaveHistory(GenAlg* const that);
+
+// Append the pending births of the GAHistory 'that' to its binary 
+// genealogy log
+// Return true if we could write the births, false else
+bool GAHistoryWrite(GAHistory* const that);
+
+// Double the size of the ring buffer of pending births of the 
+// GAHistory 'that', keeping its births
+void GAHistoryGrow(GAHistory* const that);
 
 // Function which return the JSON encoding of the GAHistory 'that' 
 JSONNode* GAHistoryEncodeAsJSON(const GAHistory* const that);
 
-// Flush the content of the GAHistory 'that'
+// Get the number of births in the genealogy of the GAHistory 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+long GAHistoryGetNbBirth(const GAHistory* const that);
+
+// Get the 'iBirth'-th birth in the genealogy of the GAHistory 'that'
+const GAHistoryBirth* GAHistoryGetBirth(const GAHistory* const that, 
+  const long iBirth);
+
+// Flush the content of the GAHistory 'that', discard its pending 
+// births and close its log
+// The births of the genealogy are released at once, the first chunk 
+// of the arena is kept for reuse
 void GAHistoryFlush(GAHistory* that);
 
-// Load the history into the GAHistory 'that' from the FILE 'stream'
+// Load the history into the GAHistory 'that' from the seekable FILE 
+// 'stream', either a binary genealogy log or its JSON encoding
 // Return true if we could load the history, false else
 bool GAHistoryLoad(GAHistory* const that, FILE* const stream);
 
+// Convert the binary genealogy log 'streamLog' into its JSON encoding 
+// (the same as GAHistoryEncodeAsJSON) in the stream 'streamJSON'
+// The births are converted one at a time, the log is never entirely 
+// loaded in memory
+// Return true if we could convert the history, false else
+bool GAHistoryConvertToJSON(FILE* const streamLog, 
+  FILE* const streamJSON, const bool compact);
+
 // Function which decode from JSON encoding 'json' to GAHistory 'that'
 bool GAHistoryDecodeAsJSON(GAHistory* const that,
   const JSONNode* const json);
 
+// Set the flag indexing the births of the GAHistory 'that'
+// When it's set, the births loaded so far are indexed, and the next 
+// births recorded or loaded are indexed as they come
+void GAHistorySetFlagIndex(GAHistory* const that, const bool flag);
+
+// Get the index of the genealogy of the GAHistory 'that', NULL if the
+// births are not indexed
+#if BUILDMODE != 0
+static inline
+#endif
+GAGenealogy* GAHistoryIndex(const GAHistory* const that);
+
+// Set the flag indexing the births recorded in the history of the 
+// GenAlg 'that', to query its genealogy while it runs
+#if BUILDMODE != 0
+static inline
+#endif
+void GASetFlagHistoryIndex(GenAlg* const that, const bool flag);
+
+// Get the index of the genealogy of the GenAlg 'that', NULL if its 
+// births are not indexed
+#if BUILDMODE != 0
+static inline
+#endif
+GAGenealogy* GAGetHistoryIndex(const GenAlg* const that);
+
+// Create a new empty GAGenealogy
+GAGenealogy* GAGenealogyCreate(void);
+
+// Free the memory used by the GAGenealogy 'that'
+void GAGenealogyFree(GAGenealogy** that);
+
+// Remove all the adns of the GAGenealogy 'that', its memory is kept 
+// for reuse
+void GAGenealogyFlush(GAGenealogy* const that);
+
+// Add the birth 'birth' to the GAGenealogy 'that'
+// The births of an adn already in the genealogy (the elites recorded 
+// at each epoch) are ignored
+void GAGenealogyAdd(GAGenealogy* const that, 
+  const GAHistoryBirth* const birth);
+
+// Get the number of adns in the GAGenealogy 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+long GAGenealogyGetNbAdn(const GAGenealogy* const that);
+
+// Get the birth of the adn 'id' in the GAGenealogy 'that', NULL if 
+// it's not in the genealogy
+const GAHistoryBirth* GAGenealogyGetBirth(const GAGenealogy* const that,
+  const unsigned long id);
+
+// Get the lineage depth of the adn 'id' in the GAGenealogy 'that', 
+// i.e. the number of generations on the longest path to the adns 
+// without parents, -1 if it's not in the genealogy
+long GAGenealogyGetDepth(const GAGenealogy* const that, 
+  const unsigned long id);
+
+// Get the ids of all the ancestors of the adn 'id' in the 
+// GAGenealogy 'that', from the nearest to the furthest generation
+// '*ids' points to an array owned by the GAGenealogy, valid until the
+// next query or modification
+// Return the number of ancestors, -1 if the adn is not in the 
+// genealogy
+long GAGenealogyGetAncestors(GAGenealogy* const that, 
+  const unsigned long id, const unsigned long** const ids);
+
+// Get the ids of all the descendants of the adn 'id' in the 
+// GAGenealogy 'that', from the nearest to the furthest generation
+// '*ids' points to an array owned by the GAGenealogy, valid until the
+// next query or modification
+// Return the number of descendants, -1 if the adn is not in the 
+// genealogy
+long GAGenealogyGetDescendants(GAGenealogy* const that, 
+  const unsigned long id, const unsigned long** const ids);
+
 // Set the maximum age for an entity of the GenAlg 'that'
 #if BUILDMODE != 0
 static inline
@@ -628,6 +1435,482 @@ static inline
 #endif
 unsigned long GAGetMaxAge(GenAlg* const that);
 
+// Set the flag memorizing if the genes of the adns of the GenAlg 
+// 'that' are stored in contiguous slabs owned by the GenAlg to 'flag'
+// Current genes are preserved when switching between layouts
+void GASetFlagContiguousAdn(GenAlg* const that, const bool flag);
+
+// Get the flag memorizing if the genes of the adns of the GenAlg 
+// 'that' are stored in contiguous slabs owned by the GenAlg
+#if BUILDMODE != 0
+static inline
+#endif
+bool GAGetFlagContiguousAdn(const GenAlg* const that);
+
+// Set the number of threads used by GAStep of the GenAlg 'that' 
+// to 'nb'
+// The result of GAStep doesn't depend on the number of threads
+void GASetNbThread(GenAlg* const that, const int nb);
+
+// Get the number of threads used by GAStep of the GenAlg 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+int GAGetNbThread(const GenAlg* const that);
+
+// Evaluate the new GenAlgAdn of the GenAlg 'that' with the function
+// 'fun' and the user data 'data', using 'nbThread' threads
+// (including the calling thread)
+// The values are set with GASetAdnValue once all the evaluations are
+// done, 'fun' must be thread safe if 'nbThread' is greater than 1
+void GAEvaluate(GenAlg* const that, const GAEvalFun fun, 
+  void* const data, const int nbThread);
+
+// Evaluate the new GenAlgAdn of the GenAlg 'that' with one call to 
+// the function 'fun' with the user data 'data', the genes of all the
+// new adns being given as a GAGenesMatrix
+// The values are set with GASetAdnValue once all the evaluations are
+// done, in the same order as GAEvaluate
+void GAEvaluateMatrix(GenAlg* const that, const GAMatrixEvalFun fun, 
+  void* const data);
+
+// Evaluate the new GenAlgAdn of the GenAlg 'that', whose value is the
+// average of their values for 'nbCase' test cases, the value of one
+// test case being at most 'maxCase', using 'nbThread' threads 
+// (including the calling thread)
+// The test cases are given to the function 'fun' with the user data 
+// 'data' by chunks of 'sizeChunk', and the evaluation of an adn is
+// aborted as soon as it can't be better than the worst elite amongst
+// the adns already evaluated by any thread. Its value is then the 
+// upper bound of its actual value (cf GAAdnIsPartial)
+// The elites are the same as with a complete evaluation of the adns,
+// with several threads which of the other adns are aborted depends on
+// the order of the evaluations
+// The values are set with GASetAdnValue once all the evaluations are
+// done, in the same order as GAEvaluate, 'fun' must be thread safe if
+// 'nbThread' is greater than 1
+// Return the number of test cases evaluated
+long GAEvaluateRace(GenAlg* const that, const GARaceFun fun, 
+  void* const data, const long nbCase, const long sizeChunk, 
+  const float maxCase, const int nbThread);
+
+// Return the number of candidates of the GAGenesMatrix 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+long GAGenesMatrixGetNb(const GAGenesMatrix* const that);
+
+// Return the number of columns of the GAGenesMatrix 'that', the 
+// columns after GAGenesMatrixGetNb are null and can be evaluated
+// and ignored
+#if BUILDMODE != 0
+static inline
+#endif
+long GAGenesMatrixGetStride(const GAGenesMatrix* const that);
+
+// Return the row of the 'iGene'-th gene for floating point values of
+// the GAGenesMatrix 'that', aligned on GENALG_STORE_ALIGN bytes
+#if BUILDMODE != 0
+static inline
+#endif
+const float* GAGenesMatrixAdnF(const GAGenesMatrix* const that, 
+  const long iGene);
+
+// Return the row of the 'iGene'-th gene for integer values of the 
+// GAGenesMatrix 'that', aligned on GENALG_STORE_ALIGN bytes
+#if BUILDMODE != 0
+static inline
+#endif
+const long* GAGenesMatrixAdnI(const GAGenesMatrix* const that, 
+  const long iGene);
+
+// Set the steady state mode of the GenAlg 'that' to 'flag'
+// In steady state mode, GAStep is not used: the children are created
+// one by one by GAGetSteadyChild and each one replaces the worst adn
+// of the population as soon as its value is given by 
+// GASetSteadyChildValue, if it's better. The adns of the population 
+// must have been evaluated when the mode is turned on, and all the 
+// children must have been given back when it's turned off
+// An epoch ends every (nbAdns - nbElites) children, then the ages of 
+// the elites are updated and the KT event is checked as in GAStep. 
+// The adns killed by a KT event get the lowest value, so they are 
+// the first ones replaced. The number of adns doesn't change in 
+// steady state mode
+void GASetFlagSteadyState(GenAlg* const that, const bool flag);
+
+// Get the steady state mode flag of the GenAlg 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+bool GAGetFlagSteadyState(const GenAlg* const that);
+
+// Create a new child from the elites of the GenAlg 'that' in steady 
+// state mode and return it
+// The child is not in the population, it must be evaluated and given 
+// back with GASetSteadyChildValue
+// Can be called from several threads
+GenAlgAdn* GAGetSteadyChild(GenAlg* const that);
+
+// Give back the child 'child' created by GAGetSteadyChild of the 
+// GenAlg 'that' in steady state mode with its value 'val'
+// If 'val' is better than the value of the worst adn of the 
+// population, the child replaces it and is inserted at its rank
+// 'child' must not be used anymore after this call
+// Can be called from several threads
+void GASetSteadyChildValue(GenAlg* const that, GenAlgAdn* const child,
+  const float val);
+
+// Return a new GABatch of at most 'maxBatch' new adns of the current 
+// epoch of the GenAlg 'that' which haven't been given yet
+// The batch is empty if all the new adns of the current epoch have 
+// been given and some of them are still waiting for their value
+// Several batches can be evaluated at the same time, by several 
+// threads, the ranks of the adns are not used
+GABatch* GAAsk(GenAlg* const that, const long maxBatch);
+
+// Give the values 'scores' of the candidates of the GABatch 'batch' to
+// the GenAlg 'that', 'scores' is in the order of the candidates of 
+// the batch, and free the batch
+// When all the new adns of the current epoch have their value, GAStep
+// is called and the new adns of the next epoch can be asked
+// The scores of a batch given before the last call to GAStep or 
+// GAInit are ignored
+// Return true if GAStep has been called, else false
+bool GATell(GenAlg* const that, GABatch** const batch, 
+  const float* const scores);
+
+// Free the memory used by the GABatch 'that'
+void GABatchFree(GABatch** const that);
+
+// Return the number of candidates of the GABatch 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+long GABatchGetNb(const GABatch* const that);
+
+// Return the id of the 'iCandidate'-th candidate of the GABatch 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+unsigned long GABatchGetId(const GABatch* const that, 
+  const long iCandidate);
+
+// Return the genes for floating point values of the 'iCandidate'-th 
+// candidate of the GABatch 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+const float* GABatchAdnF(const GABatch* const that, 
+  const long iCandidate);
+
+// Return the genes for integer values of the 'iCandidate'-th 
+// candidate of the GABatch 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+const long* GABatchAdnI(const GABatch* const that, 
+  const long iCandidate);
+
+// Create a new GAThreadPool with 'nbThread' threads (including the 
+// thread which will call GAThreadPoolRun)
+GAThreadPool* GAThreadPoolCreate(const int nbThread);
+
+// Free the memory used by the GAThreadPool 'that', its workers are
+// stopped
+void GAThreadPoolFree(GAThreadPool** that);
+
+// Execute the function 'fun' on the data 'data' for the 'nbTask' 
+// tasks using the threads of the GAThreadPool 'that'
+// Return when all the tasks have been executed
+void GAThreadPoolRun(GAThreadPool* const that, 
+  const GAThreadPoolFun fun, void* const data, const long nbTask);
+
+// Get the number of threads of the GAThreadPool 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+int GAThreadPoolGetNbThread(const GAThreadPool* const that);
+
+// Create a new GAIOWriter and start its thread
+GAIOWriter* GAIOWriterCreate(void);
+
+// Free the memory used by the GAIOWriter 'that', its thread is 
+// stopped after writing the pending jobs
+void GAIOWriterFree(GAIOWriter** that);
+
+// Queue the 'size' bytes 'data' to be written to the stream 'stream'
+// by the GAIOWriter 'that', which takes the ownership of 'data'
+// Wait if more than GENALG_IO_MAXQUEUE bytes are already queued
+void GAIOWriterPush(GAIOWriter* const that, FILE* const stream, 
+  char* const data, const size_t size);
+
+// Wait until all the jobs of the GAIOWriter 'that' have been written
+// Return false if a write has failed since the creation of the 
+// GAIOWriter or the last call to GAIOWriterResetError, true else
+bool GAIOWriterWait(GAIOWriter* const that);
+
+// Reset the error flag of the GAIOWriter 'that'
+void GAIOWriterResetError(GAIOWriter* const that);
+
+// ------------- GAIslands
+
+// ================= Data structure ===================
+
+// Topology of the migrations between the islands
+typedef enum GAMigrationTopology {
+  // Each island sends its elites to the next one
+  gaMigrationRing,
+  // Each island sends its elites to all the other ones
+  gaMigrationAllToAll
+} GAMigrationTopology;
+
+// Set of GenAlg (the islands) evolving concurrently, each on its own
+// thread, and periodically exchanging their best adns
+typedef struct GAIslands {
+  // Islands
+  GenAlg** _islands;
+  // Number of islands
+  int _nbIsland;
+  // Topology of the migrations
+  GAMigrationTopology _topology;
+  // Number of epochs between two migrations
+  unsigned long _period;
+  // Number of elites sent by an island to each of its destinations
+  int _nbMigrant;
+  // Number of migrations done
+  unsigned long _nbMigration;
+  // Pool of threads, one per island
+  GAThreadPool* _pool;
+} GAIslands;
+
+// ================ Functions declaration ====================
+
+// Create a new GAIslands with 'nbIsland' GenAlg created with 
+// 'nbEntities', 'nbElites', 'lengthAdnF' and 'lengthAdnI' (cf 
+// GenAlgCreate)
+// By default the topology is gaMigrationRing, the period is 10 epochs 
+// and one elite migrates
+// The islands must be configured with GAIslandsGenAlg and initialised
+// with GAIslandsInit
+GAIslands* GAIslandsCreate(const int nbIsland, const int nbEntities, 
+  const int nbElites, const long lengthAdnF, const long lengthAdnI);
+
+// Free the memory used by the GAIslands 'that' and its islands
+void GAIslandsFree(GAIslands** that);
+
+// Return the number of islands of the GAIslands 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+int GAIslandsGetNbIsland(const GAIslands* const that);
+
+// Return the 'iIsland'-th island of the GAIslands 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+GenAlg* GAIslandsGenAlg(const GAIslands* const that, const int iIsland);
+
+// Set the topology of the migrations of the GAIslands 'that' to 
+// 'topology'
+#if BUILDMODE != 0
+static inline
+#endif
+void GAIslandsSetTopology(GAIslands* const that, 
+  const GAMigrationTopology topology);
+
+// Return the topology of the migrations of the GAIslands 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+GAMigrationTopology GAIslandsGetTopology(const GAIslands* const that);
+
+// Set the number of epochs between two migrations of the GAIslands
+// 'that' to 'period'
+#if BUILDMODE != 0
+static inline
+#endif
+void GAIslandsSetPeriod(GAIslands* const that, 
+  const unsigned long period);
+
+// Return the number of epochs between two migrations of the 
+// GAIslands 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+unsigned long GAIslandsGetPeriod(const GAIslands* const that);
+
+// Set the number of elites sent by an island of the GAIslands 'that' 
+// to each of its destinations to 'nb'
+// If 'nb' is greater than the number of elites of an island, only its
+// elites migrate
+#if BUILDMODE != 0
+static inline
+#endif
+void GAIslandsSetNbMigrant(GAIslands* const that, const int nb);
+
+// Return the number of elites sent by an island of the GAIslands 
+// 'that' to each of its destinations
+#if BUILDMODE != 0
+static inline
+#endif
+int GAIslandsGetNbMigrant(const GAIslands* const that);
+
+// Return the number of migrations done by the GAIslands 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+unsigned long GAIslandsGetNbMigration(const GAIslands* const that);
+
+// Set the seed of the 'iIsland'-th island of the GAIslands 'that' 
+// to 'seed' + 'iIsland'
+void GAIslandsSetSeed(GAIslands* const that, const unsigned long seed);
+
+// Init the islands of the GAIslands 'that'
+// Must be called after the bounds of the islands have been set
+void GAIslandsInit(GAIslands* const that);
+
+// Evaluate and step 'period' epochs of each island of the GAIslands 
+// 'that' concurrently, the islands' new adns being evaluated with the
+// function 'fun' and the user data 'data', then migrate the best 
+// adns of each island into the non elite adns of its destinations
+// 'fun' is called with the index of the thread of the island and 
+// must be thread safe
+// The migrants keep their value and are not evaluated again
+// The result doesn't depend on the scheduling of the threads
+void GAIslandsStep(GAIslands* const that, const GAEvalFun fun, 
+  void* const data);
+
+// Return the best adn amongst the best adns of the islands of the 
+// GAIslands 'that'
+const GenAlgAdn* GAIslandsBestAdn(const GAIslands* const that);
+
+// ------------- GAWorkerPool
+
+// ================= Data structure ===================
+
+// Header of the messages between a GAWorkerPool and its workers
+// A request is the header followed by the int genes of its 'nb' 
+// candidates and then their float genes, a reply is the header 
+// followed by the 'nb' values of the candidates
+// Data are in the native byte order as the workers are local
+// A request with 'nb' equal to 0 stops the worker
+typedef struct GAWorkerHead {
+  // Number of candidates
+  uint32_t _nb;
+  // Length of the float and int genes of each candidate
+  uint32_t _lengthAdnF;
+  uint32_t _lengthAdnI;
+} GAWorkerHead;
+
+// Worker process of a GAWorkerPool
+typedef struct GAWorker {
+  // Id of the process
+  pid_t _pid;
+  // Socket connected to the worker, -1 if the worker has failed
+  int _fd;
+  // Index of the first candidate sent to the worker and number of 
+  // candidates whose value is pending
+  long _first;
+  long _nb;
+  // Time in ms (CLOCK_MONOTONIC) before which the worker must reply
+  long _deadline;
+} GAWorker;
+
+// Pool of local processes evaluating the new adns of a GenAlg, each
+// connected to the pool through a Unix domain socket
+typedef struct GAWorkerPool {
+  // Workers
+  GAWorker* _workers;
+  // Number of workers
+  int _nbWorker;
+  // Maximum number of candidates per request
+  long _maxBatch;
+  // Time in ms given to a worker to reply to a request, -1 if 
+  // unlimited
+  int _timeout;
+  // Buffer of the messages and its size in bytes
+  char* _buffer;
+  size_t _sizeBuffer;
+} GAWorkerPool;
+
+// Function evaluating in a worker the candidate with 'lengthAdnF' 
+// float genes 'adnF' and 'lengthAdnI' int genes 'adnI', with the user
+// data 'data'
+typedef float (*GAWorkerFun)(const float* const adnF, 
+  const long lengthAdnF, const long* const adnI, 
+  const long lengthAdnI, void* const data);
+
+// ================ Functions declaration ====================
+
+// Create a new GAWorkerPool with 'nbWorker' processes running the 
+// executable 'path', the socket to the pool being their standard 
+// input (cf GAWorkerServe)
+// By default a request contains at most 16 candidates and the 
+// workers have no time limit to reply
+GAWorkerPool* GAWorkerPoolCreate(const char* const path, 
+  const int nbWorker);
+
+// Free the memory used by the GAWorkerPool 'that', its workers are 
+// stopped and waited for
+void GAWorkerPoolFree(GAWorkerPool** that);
+
+// Return the number of workers of the GAWorkerPool 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+int GAWorkerPoolGetNbWorker(const GAWorkerPool* const that);
+
+// Set the maximum number of candidates per request of the 
+// GAWorkerPool 'that' to 'maxBatch'
+#if BUILDMODE != 0
+static inline
+#endif
+void GAWorkerPoolSetMaxBatch(GAWorkerPool* const that, 
+  const long maxBatch);
+
+// Return the maximum number of candidates per request of the 
+// GAWorkerPool 'that'
+#if BUILDMODE != 0
+static inline
+#endif
+long GAWorkerPoolGetMaxBatch(const GAWorkerPool* const that);
+
+// Set the time in ms given to a worker of the GAWorkerPool 'that' to 
+// reply to a request to 'timeout', -1 for unlimited
+#if BUILDMODE != 0
+static inline
+#endif
+void GAWorkerPoolSetTimeout(GAWorkerPool* const that, 
+  const int timeout);
+
+// Return the time in ms given to a worker of the GAWorkerPool 'that' 
+// to reply to a request, -1 if unlimited
+#if BUILDMODE != 0
+static inline
+#endif
+int GAWorkerPoolGetTimeout(const GAWorkerPool* const that);
+
+// Evaluate the new GenAlgAdn of the GenAlg 'ga' with the workers of 
+// the GAWorkerPool 'that'
+// The candidates are spread over the workers in requests of at most
+// GAWorkerPoolGetMaxBatch candidates, and a worker receives a new 
+// request as soon as it has replied
+// The values are set with GASetAdnValue once all the evaluations are
+// done, in the same order as GAEvaluate
+// Return false and set no value if a worker has failed, i.e. closed
+// the connection or didn't reply within GAWorkerPoolGetTimeout, the
+// failed workers are killed and not used anymore
+bool GAWorkerPoolEvaluate(GAWorkerPool* const that, GenAlg* const ga);
+
+// Serve the requests of a GAWorkerPool received on the socket 'fd', 
+// evaluating the candidates with the function 'fun' and the user 
+// data 'data', until the pool stops the worker
+// To be called by the executable of the workers with STDIN_FILENO
+// Return true if the worker has been stopped by the pool, false if
+// the connection failed
+bool GAWorkerServe(const int fd, const GAWorkerFun fun, 
+  void* const data);
+
 // ================= Polymorphism ==================
 
 // ================ static inliner ====================
@@ -9,6 +9,39 @@
 
 #define RANDOMSEED 2
 
+void UnitTestGARngUnif() {
+  GARng rngA = GARngCreateStatic(RANDOMSEED, 0);
+  GARng rngB = GARngCreateStatic(RANDOMSEED, 0);
+  GARng rngC = GARngCreateStatic(RANDOMSEED, 1);
+  int nbSample = 10000;
+  int nbSameStream = 0;
+  float sum = 0.0;
+  for (int iSample = nbSample; iSample--;) {
+    float a = GARngUnif(&rngA);
+    float b = GARngUnif(&rngB);
+    float c = GARngUnif(&rngC);
+    if (a < 0.0 || a >= 1.0 || a != b) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GARngUnif failed");
+      PBErrCatch(GenAlgErr);
+    }
+    if (a == c)
+      ++nbSameStream;
+    sum += a;
+  }
+  if (nbSameStream > 10 || fabs(sum / (float)nbSample - 0.5) > 0.01) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GARngUnif failed");
+    PBErrCatch(GenAlgErr);
+  }
+  printf("UnitTestGARngUnif OK\n");
+}
+
+void UnitTestGARng() {
+  UnitTestGARngUnif();
+  printf("UnitTestGARng OK\n");
+}
+
 void UnitTestGenAlgAdnCreateFree() {
   unsigned long int id = 1;
   int lengthAdnF = 2;
@@ -132,11 +165,12 @@ void UnitTestGenAlgAdnInit() {
   GASetBoundsAdnFloat(ga, 1, &boundsF);
   GASetBoundsAdnInt(ga, 0, &boundsI);
   GASetBoundsAdnInt(ga, 1, &boundsI);
+  GASetSeed(ga, 5);
   GAAdnInit(ent, ga);
-  if (ISEQUALF(VecGet(ent->_adnF, 0), -0.907064) == false ||
-    ISEQUALF(VecGet(ent->_adnF, 1), -0.450509) == false ||
+  if (ISEQUALF(VecGet(ent->_adnF, 0), 0.935807) == false ||
+    ISEQUALF(VecGet(ent->_adnF, 1), 0.095687) == false ||
     VecGet(ent->_adnI, 0) != 2 ||
-    VecGet(ent->_adnI, 1) != 10) {
+    VecGet(ent->_adnI, 1) != 3) {
     GenAlgErr->_type = PBErrTypeUnitTestFailed;
     sprintf(GenAlgErr->_msg, "GAAdnInit failed");
     PBErrCatch(GenAlgErr);
@@ -153,6 +187,31 @@ void UnitTestGenAlgAdn() {
   printf("UnitTestGenAlgAdn OK\n");
 }
 
+// Set the bounds of the genes of the GenAlg 'ga' to [-1, 1] for the 
+// floats and [0, 4] for the ints, as expected by evaluate()
+void UnitTestGenAlgSetBounds(GenAlg* const ga) {
+  VecFloat2D boundsF = VecFloatCreateStatic2D();
+  VecLong2D boundsI = VecLongCreateStatic2D();
+  VecSet(&boundsF, 0, -1.0); VecSet(&boundsF, 1, 1.0);
+  VecSet(&boundsI, 0, 0); VecSet(&boundsI, 1, 4);
+  for (int i = GAGetLengthAdnFloat(ga); i--;)
+    GASetBoundsAdnFloat(ga, i, &boundsF);
+  for (int i = GAGetLengthAdnInt(ga); i--;)
+    GASetBoundsAdnInt(ga, i, &boundsI);
+}
+
+// Return a new GenAlg of 'nbAdn' adns and 'nbElite' elites with 
+// 'lengthAdn' float and int genes bounded by UnitTestGenAlgSetBounds,
+// seeded with RANDOMSEED and initialised
+GenAlg* UnitTestGenAlgFixtureCreate(const int nbAdn, const int nbElite,
+  const int lengthAdn) {
+  GenAlg* ga = GenAlgCreate(nbAdn, nbElite, lengthAdn, lengthAdn);
+  UnitTestGenAlgSetBounds(ga);
+  GASetSeed(ga, RANDOMSEED);
+  GAInit(ga);
+  return ga;
+}
+
 void UnitTestGenAlgCreateFree() {
   int lengthAdnF = 2;
   int lengthAdnI = 3;
@@ -363,12 +422,13 @@ void UnitTestGenAlgInit() {
   GASetBoundsAdnFloat(ga, 1, &boundsF);
   GASetBoundsAdnInt(ga, 0, &boundsI);
   GASetBoundsAdnInt(ga, 1, &boundsI);
+  GASetSeed(ga, 5);
   GAInit(ga);
   GenAlgAdn* ent = (GenAlgAdn*)(GAAdns(ga)->_head->_data);
-  if (ISEQUALF(VecGet(ent->_adnF, 0), -0.907064) == false ||
-    ISEQUALF(VecGet(ent->_adnF, 1), -0.450509) == false ||
+  if (ISEQUALF(VecGet(ent->_adnF, 0), 0.935807) == false ||
+    ISEQUALF(VecGet(ent->_adnF, 1), 0.095687) == false ||
     VecGet(ent->_adnI, 0) != 2 ||
-    VecGet(ent->_adnI, 1) != 10) {
+    VecGet(ent->_adnI, 1) != 3) {
     GenAlgErr->_type = PBErrTypeUnitTestFailed;
     sprintf(GenAlgErr->_msg, "GAInit failed");
     PBErrCatch(GenAlgErr);
@@ -430,6 +490,185 @@ void UnitTestGenAlgGetDiversity() {
   printf("UnitTestGenAlgGetDiversity OK\n");
 }
 
+void UnitTestGenAlgAdnGetDiversity() {
+  int lengthAdnF = 11;
+  int lengthAdnI = 3;
+  GenAlg* ga = GenAlgCreate(GENALG_NBENTITIES, GENALG_NBELITES, 
+    lengthAdnF, lengthAdnI);
+  VecFloat2D boundsF = VecFloatCreateStatic2D();
+  VecLong2D boundsI = VecLongCreateStatic2D();
+  VecSet(&boundsF, 0, -1.0); VecSet(&boundsF, 1, 1.0);
+  VecSet(&boundsI, 0, 0); VecSet(&boundsI, 1, 4);
+  for (int i = lengthAdnF; i--;)
+    GASetBoundsAdnFloat(ga, i, &boundsF);
+  for (int i = lengthAdnI; i--;)
+    GASetBoundsAdnInt(ga, i, &boundsI);
+  GASetSeed(ga, RANDOMSEED);
+  GAInit(ga);
+  GenAlgAdn* adnA = GAAdn(ga, 0);
+  GenAlgAdn* adnB = GAAdn(ga, 1);
+  // Calculate the diversity with the vector operations
+  VecFloat* diffF = 
+    VecGetOp(GAAdnAdnF(adnA), 1.0, GAAdnAdnF(adnB), -1.0);
+  VecLong* diffI = VecGetOp(GAAdnAdnI(adnA), 1, GAAdnAdnI(adnB), -1);
+  VecFloat* diffIF = VecLongToFloat(diffI);
+  float check = 0.5 * (VecNorm(diffF) / ga->_normRangeFloat +
+    VecNorm(diffIF) / ga->_normRangeInt);
+  if (ISEQUALF(GAAdnGetDiversity(adnA, adnB, ga), check) == false ||
+    ISEQUALF(GAAdnGetDiversity(adnA, adnA, ga), 0.0) == false) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAAdnGetDiversity failed");
+    PBErrCatch(GenAlgErr);
+  }
+  float diversities[GENALG_NBELITES];
+  GAGetDiversityToElites(ga, adnB, diversities);
+  for (int iElite = GAGetNbElites(ga); iElite--;) {
+    if (ISEQUALF(diversities[iElite], 
+      GAAdnGetDiversity(adnB, GAAdn(ga, iElite), ga)) == false) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GAGetDiversityToElites failed");
+      PBErrCatch(GenAlgErr);
+    }
+  }
+  VecFree(&diffF);
+  VecFree(&diffI);
+  VecFree(&diffIF);
+  GenAlgFree(&ga);
+  printf("UnitTestGenAlgAdnGetDiversity OK\n");
+}
+
+void UnitTestGenAlgEliteDiversity() {
+  int lengthAdnF = 5;
+  int lengthAdnI = 2;
+  GenAlg* ga = GenAlgCreate(GENALG_NBENTITIES, GENALG_NBELITES, 
+    lengthAdnF, lengthAdnI);
+  VecFloat2D boundsF = VecFloatCreateStatic2D();
+  VecLong2D boundsI = VecLongCreateStatic2D();
+  VecSet(&boundsF, 0, -1.0); VecSet(&boundsF, 1, 1.0);
+  VecSet(&boundsI, 0, 0); VecSet(&boundsI, 1, 10);
+  for (int i = lengthAdnF; i--;)
+    GASetBoundsAdnFloat(ga, i, &boundsF);
+  for (int i = lengthAdnI; i--;)
+    GASetBoundsAdnInt(ga, i, &boundsI);
+  GASetSeed(ga, RANDOMSEED);
+  GAInit(ga);
+  GARng rng = GARngCreateStatic(RANDOMSEED, 0);
+  int nbElites = GAGetNbElites(ga);
+  for (int iStep = 0; iStep < 20; ++iStep) {
+    GAUpdateEliteDiversity(ga);
+    // The first update and the update after a reset recalculate all 
+    // the elites, an update without change recalculates nothing
+    int nbUpdated = ga->_eliteDiversity._nbUpdated;
+    if ((iStep == 0 && nbUpdated != nbElites) || nbUpdated > nbElites) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, 
+        "GAUpdateEliteDiversity failed (%d)", nbUpdated);
+      PBErrCatch(GenAlgErr);
+    }
+    GAUpdateEliteDiversity(ga);
+    if (ga->_eliteDiversity._nbUpdated != 0) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GAUpdateEliteDiversity failed");
+      PBErrCatch(GenAlgErr);
+    }
+    // Compare with the diversities calculated from scratch
+    float sum = 0.0;
+    float min = 0.0;
+    for (int iElite = 0; iElite < nbElites; ++iElite) {
+      for (int jElite = iElite + 1; jElite < nbElites; ++jElite) {
+        float d = GAAdnGetDiversity(
+          GAAdn(ga, iElite), GAAdn(ga, jElite), ga);
+        sum += d;
+        if ((iElite == 0 && jElite == 1) || d < min)
+          min = d;
+      }
+    }
+    float avg = sum / (float)(nbElites * (nbElites - 1) / 2);
+    if (ISEQUALF(GAGetEliteDiversityAvg(ga), avg) == false ||
+      ISEQUALF(GAGetEliteDiversityMin(ga), min) == false) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GAGetEliteDiversity failed");
+      PBErrCatch(GenAlgErr);
+    }
+    for (int iAdn = GAGetNbAdns(ga); iAdn--;)
+      GASetAdnValue(ga, GAAdn(ga, iAdn), GARngUnif(&rng));
+    GAStep(ga);
+  }
+  GAResetEliteDiversity(ga);
+  GAUpdateEliteDiversity(ga);
+  if (ga->_eliteDiversity._nbUpdated != nbElites) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAResetEliteDiversity failed");
+    PBErrCatch(GenAlgErr);
+  }
+  GASetFlagEliteDiversity(ga, true);
+  if (GAGetFlagEliteDiversity(ga) != true) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GASetFlagEliteDiversity failed");
+    PBErrCatch(GenAlgErr);
+  }
+  GenAlgFree(&ga);
+  printf("UnitTestGenAlgEliteDiversity OK\n");
+}
+
+float UnitTestGenAlgFitnessCacheFun(const GenAlgAdn* const adn) {
+  return (float)(GAAdnGetGeneI(adn, 0) + 3 * GAAdnGetGeneI(adn, 1));
+}
+
+void UnitTestGenAlgFitnessCache() {
+  int lengthAdnI = 2;
+  GenAlg* ga = GenAlgCreate(GENALG_NBENTITIES, GENALG_NBELITES, 
+    0, lengthAdnI);
+  VecLong2D boundsI = VecLongCreateStatic2D();
+  VecSet(&boundsI, 0, 0); VecSet(&boundsI, 1, 3);
+  for (int i = lengthAdnI; i--;)
+    GASetBoundsAdnInt(ga, i, &boundsI);
+  GASetSeed(ga, RANDOMSEED);
+  GAInit(ga);
+  // Run first with a cache large enough for all the possible adns, 
+  // then with a cache too small for them
+  int sizes[2] = {100, 4};
+  for (int iSize = 0; iSize < 2; ++iSize) {
+    GASetFitnessCacheSize(ga, sizes[iSize]);
+    if (GAGetFitnessCacheSize(ga) != sizes[iSize]) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GASetFitnessCacheSize failed");
+      PBErrCatch(GenAlgErr);
+    }
+    unsigned long nbChild = 0;
+    for (int iEpoch = 0; iEpoch < 10; ++iEpoch) {
+      for (int iAdn = GAGetNbAdns(ga); iAdn--;) {
+        GenAlgAdn* adn = GAAdn(ga, iAdn);
+        // The value of the cached adns must be the one they would 
+        // get from the evaluation
+        if (adn->_flagCachedVal == true && 
+          ISEQUALF(GAAdnGetVal(adn), 
+            UnitTestGenAlgFitnessCacheFun(adn)) == false) {
+          GenAlgErr->_type = PBErrTypeUnitTestFailed;
+          sprintf(GenAlgErr->_msg, "GAFitnessCache failed");
+          PBErrCatch(GenAlgErr);
+        }
+        if (GAAdnIsNew(adn))
+          GASetAdnValue(ga, adn, UnitTestGenAlgFitnessCacheFun(adn));
+      }
+      nbChild += GAGetNbAdns(ga) - GAGetNbElites(ga);
+      GAStep(ga);
+    }
+    // With 16 possible adns many children must be found in the cache
+    if (GAGetNbFitnessCacheHit(ga) == 0 ||
+      GAGetNbFitnessCacheHit(ga) + GAGetNbFitnessCacheMiss(ga) != 
+        nbChild ||
+      ga->_fitnessCache._nb > sizes[iSize]) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GAFitnessCache failed (%lu %lu)",
+        GAGetNbFitnessCacheHit(ga), GAGetNbFitnessCacheMiss(ga));
+      PBErrCatch(GenAlgErr);
+    }
+  }
+  GenAlgFree(&ga);
+  printf("UnitTestGenAlgFitnessCache OK\n");
+}
+
 void UnitTestGenAlgStep() {
   srandom(2);
   int lengthAdnF = 2;
@@ -443,6 +682,7 @@ void UnitTestGenAlgStep() {
   GASetBoundsAdnFloat(ga, 1, &boundsF);
   GASetBoundsAdnInt(ga, 0, &boundsI);
   GASetBoundsAdnInt(ga, 1, &boundsI);
+  GASetSeed(ga, 2);
   GAInit(ga);
   for (int i = 3; i--;)
     GASetAdnValue(ga, GAAdn(ga, i), 3.0 - (float)i);
@@ -454,12 +694,12 @@ void UnitTestGenAlgStep() {
   GAPrintln(ga, stdout);
   if (ga->_nextId != 4 || GAAdnGetId(child) != 3 || 
     GAAdnGetAge(child) != 1 ||
-    ISEQUALF(GAAdnGetGeneF(child, 0), 0.285933) == false ||
-    ISEQUALF(GAAdnGetGeneF(child, 1), 0.174965) == false ||
-    ISEQUALF(GAAdnGetDeltaGeneF(child, 0), 0.0) == false ||
+    ISEQUALF(GAAdnGetGeneF(child, 0), -0.783923) == false ||
+    ISEQUALF(GAAdnGetGeneF(child, 1), 0.906831) == false ||
+    ISEQUALF(GAAdnGetDeltaGeneF(child, 0), -0.687973) == false ||
     ISEQUALF(GAAdnGetDeltaGeneF(child, 1), 0.0) == false ||
-    GAAdnGetGeneI(child, 0) != 4 ||
-    GAAdnGetGeneI(child, 1) != 10 ||
+    GAAdnGetGeneI(child, 0) != 1 ||
+    GAAdnGetGeneI(child, 1) != 9 ||
     GAAdn(ga, 2) != child ||
     GAAdnGetAge(GAAdn(ga, 0)) != 2 ||
     GAAdnGetAge(GAAdn(ga, 1)) != 2 ||
@@ -473,6 +713,85 @@ void UnitTestGenAlgStep() {
   printf("UnitTestGenAlgStep OK\n");
 }
 
+void UnitTestGenAlgMuteBounds() {
+  // Use a length covering several blocks of the mutation kernel
+  int lengthAdnF = 2 * GENALG_MUTE_BLOCK + 3;
+  GenAlg* ga = GenAlgCreate(GENALG_NBENTITIES, GENALG_NBELITES, 
+    lengthAdnF, 0);
+  VecFloat2D boundsF = VecFloatCreateStatic2D();
+  for (int i = lengthAdnF; i--;) {
+    VecSet(&boundsF, 0, -1.0 - (float)i); 
+    VecSet(&boundsF, 1, 0.01 * (float)i);
+    GASetBoundsAdnFloat(ga, i, &boundsF);
+  }
+  GASetSeed(ga, RANDOMSEED);
+  GAInit(ga);
+  for (int iEpoch = 0; iEpoch < 10; ++iEpoch) {
+    for (int iEnt = GAGetNbAdns(ga); iEnt--;)
+      GASetAdnValue(ga, GAAdn(ga, iEnt), 
+        -1.0 * VecNorm(GAAdnAdnF(GAAdn(ga, iEnt))));
+    GAStep(ga);
+    for (int iEnt = GAGetNbAdns(ga); iEnt--;) {
+      for (int i = lengthAdnF; i--;) {
+        float val = GAAdnGetGeneF(GAAdn(ga, iEnt), i);
+        if (val < -1.0 - (float)i - PBMATH_EPSILON || 
+          val > 0.01 * (float)i + PBMATH_EPSILON) {
+          GenAlgErr->_type = PBErrTypeUnitTestFailed;
+          sprintf(GenAlgErr->_msg, "GAMuteDefault failed");
+          PBErrCatch(GenAlgErr);
+        }
+      }
+    }
+  }
+  GenAlgFree(&ga);
+  printf("UnitTestGenAlgMuteBounds OK\n");
+}
+
+void UnitTestGenAlgMuteSparse() {
+  // Use a genome long enough for the probability of mutation to be 
+  // low
+  int lengthAdnF = 1000;
+  GenAlg* ga = GenAlgCreate(GENALG_NBENTITIES, GENALG_NBELITES, 
+    lengthAdnF, 0);
+  VecFloat2D boundsF = VecFloatCreateStatic2D();
+  VecSet(&boundsF, 0, -1.0); VecSet(&boundsF, 1, 1.0);
+  for (int i = lengthAdnF; i--;)
+    GASetBoundsAdnFloat(ga, i, &boundsF);
+  GASetSeed(ga, RANDOMSEED);
+  GAInit(ga);
+  // Give the same genes to all the adns, so the mutated genes of the
+  // children are the ones different from these genes
+  VecFloat* ref = VecClone(GAAdnAdnF(GAAdn(ga, 0)));
+  for (int iEnt = GAGetNbAdns(ga); iEnt--;) {
+    VecCopy(GAAdn(ga, iEnt)->_adnF, ref);
+    GASetAdnValue(ga, GAAdn(ga, iEnt), (float)iEnt);
+  }
+  GAStep(ga);
+  int nbMutedTotal = 0;
+  for (int iEnt = GAGetNbElites(ga); iEnt < GAGetNbAdns(ga); ++iEnt) {
+    int nbMuted = 0;
+    for (int i = lengthAdnF; i--;)
+      if (ISEQUALF(GAAdnGetGeneF(GAAdn(ga, iEnt), i), 
+        VecGet(ref, i)) == false)
+        ++nbMuted;
+    if (nbMuted == 0) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GAMuteDefault failed");
+      PBErrCatch(GenAlgErr);
+    }
+    nbMutedTotal += nbMuted;
+  }
+  if (nbMutedTotal > 
+    5 * (GAGetNbAdns(ga) - GAGetNbElites(ga))) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAMuteDefault failed");
+    PBErrCatch(GenAlgErr);
+  }
+  VecFree(&ref);
+  GenAlgFree(&ga);
+  printf("UnitTestGenAlgMuteSparse OK\n");
+}
+
 void UnitTestGenAlgLoadSave() {
   srandom(5);
   int lengthAdnF = 2;
@@ -550,6 +869,304 @@ void UnitTestGenAlgLoadSave() {
   printf("UnitTestGenAlgLoadSave OK\n");
 }
 
+bool UnitTestGenAlgIsEqual(const GenAlg* const ga, 
+  const GenAlg* const gaLoad) {
+  if (ga->_nextId != gaLoad->_nextId ||
+    ga->_curEpoch != gaLoad->_curEpoch ||
+    ga->_nbElites != gaLoad->_nbElites ||
+    ga->_type != gaLoad->_type ||
+    ga->_seed != gaLoad->_seed ||
+    ga->_lengthAdnF != gaLoad->_lengthAdnF ||
+    ga->_lengthAdnI != gaLoad->_lengthAdnI ||
+    GAGetNbAdns(ga) != GAGetNbAdns(gaLoad) ||
+    ISEQUALF(ga->_normRangeFloat, gaLoad->_normRangeFloat) == false ||
+    ISEQUALF(ga->_normRangeInt, gaLoad->_normRangeInt) == false)
+    return false;
+  for (long iGene = ga->_lengthAdnF; iGene--;)
+    if (VecIsEqual(ga->_boundsF + iGene, 
+      gaLoad->_boundsF + iGene) == false ||
+      ga->_boundsMinF[iGene] != gaLoad->_boundsMinF[iGene] ||
+      ga->_boundsMaxF[iGene] != gaLoad->_boundsMaxF[iGene])
+      return false;
+  for (long iGene = ga->_lengthAdnI; iGene--;)
+    if (VecIsEqual(ga->_boundsI + iGene, 
+      gaLoad->_boundsI + iGene) == false)
+      return false;
+  for (int iAdn = -1; iAdn < GAGetNbAdns(ga); ++iAdn) {
+    const GenAlgAdn* adn = GAAdn(ga, iAdn);
+    const GenAlgAdn* adnLoad = GAAdn(gaLoad, iAdn);
+    if (GAAdnGetId(adn) != GAAdnGetId(adnLoad) ||
+      GAAdnGetAge(adn) != GAAdnGetAge(adnLoad) ||
+      GAAdnGetVal(adn) != GAAdnGetVal(adnLoad) ||
+      VecIsEqual(adn->_adnF, adnLoad->_adnF) == false ||
+      VecIsEqual(adn->_deltaAdnF, adnLoad->_deltaAdnF) == false ||
+      VecIsEqual(adn->_adnI, adnLoad->_adnI) == false)
+      return false;
+  }
+  return true;
+}
+
+void UnitTestGenAlgLoadSaveBinary() {
+  int lengthAdnF = 20;
+  int lengthAdnI = 5;
+  GenAlg* ga = GenAlgCreate(GENALG_NBENTITIES, GENALG_NBELITES, 
+    lengthAdnF, lengthAdnI);
+  VecFloat2D boundsF = VecFloatCreateStatic2D();
+  VecLong2D boundsI = VecLongCreateStatic2D();
+  for (int i = lengthAdnF; i--;) {
+    VecSet(&boundsF, 0, -1.0 - (float)i); VecSet(&boundsF, 1, 1.0);
+    GASetBoundsAdnFloat(ga, i, &boundsF);
+  }
+  for (int i = lengthAdnI; i--;) {
+    VecSet(&boundsI, 0, i); VecSet(&boundsI, 1, 10);
+    GASetBoundsAdnInt(ga, i, &boundsI);
+  }
+  GASetSeed(ga, RANDOMSEED);
+  GAInit(ga);
+  GARng rng = GARngCreateStatic(RANDOMSEED, 0);
+  for (int iEpoch = 0; iEpoch < 3; ++iEpoch) {
+    for (int iAdn = GAGetNbAdns(ga); iAdn--;)
+      GASetAdnValue(ga, GAAdn(ga, iAdn), GARngUnif(&rng));
+    GAStep(ga);
+  }
+  // Save two snapshots one after the other
+  FILE* stream = fopen("./UnitTestGenAlgLoadSaveBinary.bin", "wb");
+  if (GASaveBinary(ga, stream) == false ||
+    GASaveBinary(ga, stream) == false) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GASaveBinary failed");
+    PBErrCatch(GenAlgErr);
+  }
+  long size = ftell(stream);
+  fclose(stream);
+  // Load them from the file, with memory mapping
+  stream = fopen("./UnitTestGenAlgLoadSaveBinary.bin", "rb");
+  GenAlg* gaLoad = NULL;
+  for (int iSnapshot = 0; iSnapshot < 2; ++iSnapshot) {
+    if (GALoadBinary(&gaLoad, stream) == false ||
+      UnitTestGenAlgIsEqual(ga, gaLoad) == false ||
+      ftell(stream) != (iSnapshot + 1) * size / 2) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GALoadBinary failed");
+      PBErrCatch(GenAlgErr);
+    }
+  }
+  // Nothing more to load
+  if (GALoadBinary(&gaLoad, stream) == true) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GALoadBinary failed");
+    PBErrCatch(GenAlgErr);
+  }
+  // Load them from memory, without memory mapping
+  rewind(stream);
+  char* buffer = PBErrMalloc(GenAlgErr, size);
+  if (fread(buffer, 1, size, stream) != (size_t)size) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GALoadBinary failed");
+    PBErrCatch(GenAlgErr);
+  }
+  fclose(stream);
+  stream = fmemopen(buffer, size, "rb");
+  for (int iSnapshot = 0; iSnapshot < 2; ++iSnapshot) {
+    if (GALoadBinary(&gaLoad, stream) == false ||
+      UnitTestGenAlgIsEqual(ga, gaLoad) == false) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GALoadBinary failed");
+      PBErrCatch(GenAlgErr);
+    }
+  }
+  fclose(stream);
+  // A corrupted snapshot must be rejected
+  char byte = buffer[20];
+  buffer[20] = 0xFF;
+  stream = fmemopen(buffer, size, "rb");
+  if (GALoadBinary(&gaLoad, stream) == true) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GALoadBinary failed");
+    PBErrCatch(GenAlgErr);
+  }
+  fclose(stream);
+  // A snapshot whose header claims a huge size must be rejected 
+  // before allocating the memory for it (the size is the last 
+  // field of the header, at byte 112)
+  buffer[20] = byte;
+  memset(buffer + 112, 0x7F, sizeof(uint64_t));
+  stream = fmemopen(buffer, size, "rb");
+  if (GALoadBinary(&gaLoad, stream) == true) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GALoadBinary failed");
+    PBErrCatch(GenAlgErr);
+  }
+  fclose(stream);
+  free(buffer);
+  GenAlgFree(&ga);
+  GenAlgFree(&gaLoad);
+  printf("UnitTestGenAlgLoadSaveBinary OK\n");
+}
+
+void UnitTestGenAlgSaveStream() {
+  GenAlg* ga = GenAlgCreate(GENALG_NBENTITIES, GENALG_NBELITES, 3, 2);
+  VecFloat2D boundsF = VecFloatCreateStatic2D();
+  VecLong2D boundsI = VecLongCreateStatic2D();
+  VecSet(&boundsF, 0, -1.0); VecSet(&boundsF, 1, 1.0);
+  VecSet(&boundsI, 0, 1); VecSet(&boundsI, 1, 10);
+  for (int i = 3; i--;)
+    GASetBoundsAdnFloat(ga, i, &boundsF);
+  for (int i = 2; i--;)
+    GASetBoundsAdnInt(ga, i, &boundsI);
+  GASetSeed(ga, RANDOMSEED);
+  GAInit(ga);
+  GAStep(ga);
+  // The streamed encoding must be identical to the one of the 
+  // JSONNode, for each type and form
+  for (int iType = 0; iType < 2; ++iType) {
+    if (iType == 1)
+      GASetTypeNeuraNetConv(ga, 1, 2, 3, 4, 5, 6);
+    for (int compact = 0; compact < 2; ++compact) {
+      char* str[2] = {NULL};
+      size_t size[2] = {0};
+      for (int iSave = 0; iSave < 2; ++iSave) {
+        FILE* stream = open_memstream(str + iSave, size + iSave);
+        bool ret = false;
+        if (iSave == 0) {
+          ret = GASave(ga, stream, compact);
+        } else {
+          JSONNode* json = GAEncodeAsJSON(ga);
+          ret = JSONSave(json, stream, compact);
+          JSONFree(&json);
+        }
+        fclose(stream);
+        if (ret == false) {
+          GenAlgErr->_type = PBErrTypeUnitTestFailed;
+          sprintf(GenAlgErr->_msg, "GASave failed");
+          PBErrCatch(GenAlgErr);
+        }
+      }
+      if (size[0] != size[1] || strcmp(str[0], str[1]) != 0) {
+        GenAlgErr->_type = PBErrTypeUnitTestFailed;
+        sprintf(GenAlgErr->_msg, "GASave failed");
+        PBErrCatch(GenAlgErr);
+      }
+      free(str[0]);
+      free(str[1]);
+    }
+  }
+  GenAlgFree(&ga);
+  printf("UnitTestGenAlgSaveStream OK\n");
+}
+
+void UnitTestGenAlgCheckpoint() {
+  int lengthAdnF = 20;
+  int lengthAdnI = 5;
+  GenAlg* ga = GenAlgCreate(GENALG_NBENTITIES, GENALG_NBELITES, 
+    lengthAdnF, lengthAdnI);
+  VecFloat2D boundsF = VecFloatCreateStatic2D();
+  VecLong2D boundsI = VecLongCreateStatic2D();
+  VecSet(&boundsF, 0, -1.0); VecSet(&boundsF, 1, 1.0);
+  VecSet(&boundsI, 0, 1); VecSet(&boundsI, 1, 10);
+  for (int i = lengthAdnF; i--;)
+    GASetBoundsAdnFloat(ga, i, &boundsF);
+  for (int i = lengthAdnI; i--;)
+    GASetBoundsAdnInt(ga, i, &boundsI);
+  GASetSeed(ga, RANDOMSEED);
+  GAInit(ga);
+  GARng rng = GARngCreateStatic(RANDOMSEED, 0);
+  // Save a checkpoint at each epoch, the first one is a full snapshot
+  // and the following ones are smaller deltas
+  FILE* stream = fopen("./UnitTestGenAlgCheckpoint.bin", "wb");
+  long sizeFull = 0;
+  for (int iEpoch = 0; iEpoch < 5; ++iEpoch) {
+    for (int iAdn = GAGetNbAdns(ga); iAdn--;)
+      GASetAdnValue(ga, GAAdn(ga, iAdn), GARngUnif(&rng));
+    GAStep(ga);
+    long pos = ftell(stream);
+    if (GASaveCheckpoint(ga, stream) == false) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GASaveCheckpoint failed");
+      PBErrCatch(GenAlgErr);
+    }
+    if (iEpoch == 0)
+      sizeFull = ftell(stream);
+    else if (ftell(stream) - pos >= sizeFull) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GASaveCheckpoint failed");
+      PBErrCatch(GenAlgErr);
+    }
+  }
+  fclose(stream);
+  // Load the checkpoints
+  stream = fopen("./UnitTestGenAlgCheckpoint.bin", "rb");
+  GenAlg* gaLoad = NULL;
+  if (GALoadCheckpoint(&gaLoad, stream) == false ||
+    UnitTestGenAlgIsEqual(ga, gaLoad) == false) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GALoadCheckpoint failed");
+    PBErrCatch(GenAlgErr);
+  }
+  fclose(stream);
+  // The loaded GenAlg appends deltas to the same checkpoints
+  for (int iAdn = GAGetNbAdns(gaLoad); iAdn--;)
+    GASetAdnValue(gaLoad, GAAdn(gaLoad, iAdn), GARngUnif(&rng));
+  GAStep(gaLoad);
+  stream = fopen("./UnitTestGenAlgCheckpoint.bin", "ab");
+  long pos = ftell(stream);
+  if (GASaveCheckpoint(gaLoad, stream) == false ||
+    ftell(stream) - pos >= sizeFull) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GASaveCheckpoint failed");
+    PBErrCatch(GenAlgErr);
+  }
+  fclose(stream);
+  stream = fopen("./UnitTestGenAlgCheckpoint.bin", "rb");
+  if (GALoadCheckpoint(&ga, stream) == false ||
+    UnitTestGenAlgIsEqual(gaLoad, ga) == false) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GALoadCheckpoint failed");
+    PBErrCatch(GenAlgErr);
+  }
+  // Compact the checkpoints into one full snapshot
+  rewind(stream);
+  FILE* streamCompact = 
+    fopen("./UnitTestGenAlgCheckpointCompact.bin", "wb+");
+  if (GACompactCheckpoint(stream, streamCompact) == false ||
+    ftell(streamCompact) != sizeFull) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GACompactCheckpoint failed");
+    PBErrCatch(GenAlgErr);
+  }
+  fclose(stream);
+  rewind(streamCompact);
+  if (GALoadBinary(&ga, streamCompact) == false ||
+    UnitTestGenAlgIsEqual(gaLoad, ga) == false) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GACompactCheckpoint failed");
+    PBErrCatch(GenAlgErr);
+  }
+  fclose(streamCompact);
+  // After a reinitialisation the next checkpoint is a full snapshot
+  GAInit(gaLoad);
+  stream = fopen("./UnitTestGenAlgCheckpoint.bin", "ab");
+  pos = ftell(stream);
+  if (GASaveCheckpoint(gaLoad, stream) == false ||
+    ftell(stream) - pos != sizeFull) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GASaveCheckpoint failed");
+    PBErrCatch(GenAlgErr);
+  }
+  fclose(stream);
+  stream = fopen("./UnitTestGenAlgCheckpoint.bin", "rb");
+  if (GALoadCheckpoint(&ga, stream) == false ||
+    UnitTestGenAlgIsEqual(gaLoad, ga) == false) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GALoadCheckpoint failed");
+    PBErrCatch(GenAlgErr);
+  }
+  fclose(stream);
+  GenAlgFree(&ga);
+  GenAlgFree(&gaLoad);
+  printf("UnitTestGenAlgCheckpoint OK\n");
+}
+
 float ftarget(float x) {
   return -0.5 * fastpow(x, 3) + 0.314 * fastpow(x, 2) - 0.7777 * x + 0.1;
 }
@@ -583,7 +1200,7 @@ void UnitTestGenAlgTest() {
     GASetBoundsAdnInt(ga, i, &boundsI);
   }
   GASetFlagHistory(ga, true);
-  GASetHistoryPath(ga, "./history.json");
+  GASetHistoryPath(ga, "./history.bin");
   GAInit(ga);
   GASetTextOMeterFlag(ga, true);
   GASetNbMinAdn(ga, GENALG_NBELITES * 2);
@@ -694,11 +1311,13 @@ void UnitTestGenAlgHistory() {
     GASetBoundsAdnInt(ga, i, &boundsI);
   }
   GASetFlagHistory(ga, true);
-  GASetHistoryPath(ga, "./UnitTestGenAlgHistory.json");
+  GASetHistoryPath(ga, "./UnitTestGenAlgHistory.bin");
   GAInit(ga);
   GASetNbMinAdn(ga, 8);
   GASetNbMaxAdn(ga, 16);
-  float best = 1.0;
+  // Run enough epochs for the buffer of births to be appended to the 
+  // log several times
+  long nbBirth = GAGetNbAdns(ga);
   do {
     for (int iEnt = GAGetNbAdns(ga); iEnt--;)
       if (GAAdnIsNew(GAAdn(ga, iEnt)))
@@ -706,12 +1325,8 @@ void UnitTestGenAlgHistory() {
           -1.0 * evaluate(GAAdnAdnF(GAAdn(ga, iEnt)), 
           GAAdnAdnI(GAAdn(ga, iEnt))));
     GAStep(ga);
-    // Display info if there is improvment
-    float ev = evaluate(GABestAdnF(ga), GABestAdnI(ga));
-    if (best - ev > PBMATH_EPSILON) {
-      best = ev;
-    }
-  } while (GAGetCurEpoch(ga) < 10 && best > PBMATH_EPSILON);
+    nbBirth += GAGetNbAdns(ga);
+  } while (GAGetCurEpoch(ga) < 1000);
   // Save the history
   bool ret = GASaveHistory(ga);
   if (ret == false) {
@@ -719,53 +1334,1418 @@ void UnitTestGenAlgHistory() {
     sprintf(GenAlgErr->_msg, "Couldn't save the history");
     PBErrCatch(GenAlgErr);
   }
-
+  // Load the binary log
   GAHistory history = GAHistoryCreateStatic();
-  FILE* stream = fopen(GAGetHistoryPath(ga), "r");
+  FILE* stream = fopen(GAGetHistoryPath(ga), "rb");
   ret = GAHistoryLoad(&history, stream);
-  if (ret == false) {
+  if (ret == false || 
+    GAHistoryGetNbBirth(&history) != nbBirth ||
+    GAHistoryGetBirth(&history, 0)->_epoch != 0 ||
+    GAHistoryGetBirth(&history, nbBirth - 1)->_epoch != 1000) {
     GenAlgErr->_type = PBErrTypeUnitTestFailed;
     sprintf(GenAlgErr->_msg, "GAHistoryLoad failed");
     PBErrCatch(GenAlgErr);
   }
+  // Convert the log to JSON, the result must be identical to the 
+  // encoding of the loaded history
+  rewind(stream);
+  char* str[2] = {NULL};
+  size_t size[2] = {0};
+  FILE* streamJSON = open_memstream(str, size);
+  ret = GAHistoryConvertToJSON(stream, streamJSON, true);
+  fclose(streamJSON);
   fclose(stream);
-  GSetIterForward iterA = 
-    GSetIterForwardCreateStatic(&(ga->_history._genealogy));
-  GSetIterForward iterB = 
-    GSetIterForwardCreateStatic(&(history._genealogy));
-  do {
-    GAHistoryBirth* birthA = GSetIterGet(&iterA);
-    GAHistoryBirth* birthB = GSetIterGet(&iterB);
-    if (birthA->_epoch != birthB->_epoch &&
-      birthA->_idParents[0] != birthB->_idParents[0] &&
-      birthA->_idParents[1] != birthB->_idParents[1] &&
-      birthA->_idChild != birthB->_idChild) {
+  streamJSON = open_memstream(str + 1, size + 1);
+  JSONNode* json = GAHistoryEncodeAsJSON(&history);
+  ret = ret && JSONSave(json, streamJSON, true);
+  JSONFree(&json);
+  fclose(streamJSON);
+  if (ret == false || size[0] != size[1] || strcmp(str[0], str[1]) != 0) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAHistoryConvertToJSON failed");
+    PBErrCatch(GenAlgErr);
+  }
+  // Load the log and its JSON conversion from pipes, which are not 
+  // seekable
+  stream = fopen("./UnitTestGenAlgHistoryPipe.json", "w");
+  fwrite(str[0], 1, size[0], stream);
+  fclose(stream);
+  char* cmds[2] = {"cat ./UnitTestGenAlgHistoryPipe.json", NULL};
+  char cmdLog[200];
+  sprintf(cmdLog, "cat %s", GAGetHistoryPath(ga));
+  cmds[1] = cmdLog;
+  for (int iCmd = 0; iCmd < 2; ++iCmd) {
+    GAHistory historyPipe = GAHistoryCreateStatic();
+    stream = popen(cmds[iCmd], "r");
+    ret = GAHistoryLoad(&historyPipe, stream);
+    pclose(stream);
+    if (ret == false || 
+      GAHistoryGetNbBirth(&historyPipe) != nbBirth ||
+      GAHistoryGetBirth(&historyPipe, nbBirth - 1)->_idChild != 
+        GAHistoryGetBirth(&history, nbBirth - 1)->_idChild) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GAHistoryLoad failed");
+      PBErrCatch(GenAlgErr);
+    }
+    GAHistoryFree(&historyPipe);
+  }
+  remove("./UnitTestGenAlgHistoryPipe.json");
+  // Load the JSON converted from the log
+  GAHistory historyJSON = GAHistoryCreateStatic();
+  stream = fmemopen(str[0], size[0], "r");
+  ret = GAHistoryLoad(&historyJSON, stream);
+  fclose(stream);
+  free(str[0]);
+  free(str[1]);
+  if (ret == false || 
+    GAHistoryGetNbBirth(&historyJSON) != nbBirth) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAHistoryLoad failed");
+    PBErrCatch(GenAlgErr);
+  }
+  for (long iBirth = 0; iBirth < nbBirth; ++iBirth) {
+    const GAHistoryBirth* birthA = GAHistoryGetBirth(&history, iBirth);
+    const GAHistoryBirth* birthB = 
+      GAHistoryGetBirth(&historyJSON, iBirth);
+    if (birthA->_epoch != birthB->_epoch ||
+      birthA->_idParents[0] != birthB->_idParents[0] ||
+      birthA->_idParents[1] != birthB->_idParents[1] ||
+      birthA->_idChild != birthB->_idChild) {
       GenAlgErr->_type = PBErrTypeUnitTestFailed;
       sprintf(GenAlgErr->_msg, "GAHistoryLoad/Save failed");
       PBErrCatch(GenAlgErr);
     }
-    
-  } while (GSetIterStep(&iterA) && GSetIterStep(&iterB));
+  }
+  // The flushed history reuses its arena
+  GAHistoryFlush(&history);
+  stream = fopen(GAGetHistoryPath(ga), "rb");
+  ret = (GAHistoryGetNbBirth(&history) == 0) && 
+    GAHistoryLoad(&history, stream) &&
+    GAHistoryGetNbBirth(&history) == nbBirth &&
+    GAHistoryGetBirth(&history, nbBirth - 1)->_idChild == 
+      GAHistoryGetBirth(&historyJSON, nbBirth - 1)->_idChild;
+  fclose(stream);
+  if (ret == false) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAHistoryFlush failed");
+    PBErrCatch(GenAlgErr);
+  }
   GAHistoryFree(&history);
+  GAHistoryFree(&historyJSON);
   GenAlgFree(&ga);
   printf("UnitTestGenAlgHistory OK\n");
 }
 
+void UnitTestGenAlgHistoryError() {
+  GenAlg* ga = UnitTestGenAlgFixtureCreate(8, 4, 4);
+  // Restart with the history recorded
+  GASetFlagHistory(ga, true);
+  GASetHistoryPath(ga, "./UnitTestGenAlgHistoryError.bin");
+  GAInit(ga);
+  GASetNbMinAdn(ga, 8);
+  GASetNbMaxAdn(ga, 16);
+  // The births of GAInit are already saved, in a log which is 
+  // recreated by the next write at a new path
+  long nbBirth = 0;
+  for (int iMode = 0; iMode < 2; ++iMode) {
+    // Make the log unwritable and run enough epochs for the buffer of
+    // births to be full several times, GAStep must keep the births
+    // and report the error later
+    GASetFlagAsyncIO(ga, (iMode == 1));
+    GASetHistoryPath(ga, "./UnitTestGenAlgNoDir/history.bin");
+    unsigned long lastEpoch = GAGetCurEpoch(ga) + 1000;
+    do {
+      for (int iEnt = GAGetNbAdns(ga); iEnt--;)
+        if (GAAdnIsNew(GAAdn(ga, iEnt)))
+          GASetAdnValue(ga, GAAdn(ga, iEnt), 
+            -1.0 * evaluate(GAAdnAdnF(GAAdn(ga, iEnt)), 
+            GAAdnAdnI(GAAdn(ga, iEnt))));
+      GAStep(ga);
+      nbBirth += GAGetNbAdns(ga);
+    } while (GAGetCurEpoch(ga) < lastEpoch);
+    bool ret = (iMode == 0 ? GASaveHistory(ga) : GAWaitIO(ga));
+    if (ret == true) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GASaveHistory failed");
+      PBErrCatch(GenAlgErr);
+    }
+    // Once the log is writable again, all the births are saved
+    GASetHistoryPath(ga, "./UnitTestGenAlgHistoryError.bin");
+    ret = GASaveHistory(ga) && GAWaitIO(ga);
+    GAHistory history = GAHistoryCreateStatic();
+    FILE* stream = fopen(GAGetHistoryPath(ga), "rb");
+    ret = ret && GAHistoryLoad(&history, stream) &&
+      GAHistoryGetNbBirth(&history) == nbBirth;
+    fclose(stream);
+    GAHistoryFree(&history);
+    if (ret == false) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GASaveHistory failed");
+      PBErrCatch(GenAlgErr);
+    }
+    nbBirth = 0;
+  }
+  GenAlgFree(&ga);
+  remove("./UnitTestGenAlgHistoryError.bin");
+  printf("UnitTestGenAlgHistoryError OK\n");
+}
+
+void UnitTestGenAlgGenealogy() {
+  // Small genealogy: 0, 1 and 2 are created by GAInit, 3 is the child 
+  // of 0 and 1, 4 the child of 3 and 2, 5 the child of 3 alone
+  GAGenealogy* genealogy = GAGenealogyCreate();
+  GAHistoryBirth births[7] = {
+    {0, {0, 0}, 0}, {0, {1, 1}, 1}, {0, {2, 2}, 2}, {1, {0, 1}, 3},
+    {1, {0, 0}, 0}, {2, {3, 2}, 4}, {2, {3, 3}, 5}};
+  for (int iBirth = 0; iBirth < 7; ++iBirth)
+    GAGenealogyAdd(genealogy, births + iBirth);
+  const unsigned long* ids = NULL;
+  unsigned long ancestors[4] = {3, 2, 0, 1};
+  unsigned long descendants[3] = {3, 5, 4};
+  if (GAGenealogyGetNbAdn(genealogy) != 6 ||
+    GAGenealogyGetBirth(genealogy, 4)->_idParents[0] != 3 ||
+    GAGenealogyGetBirth(genealogy, 6) != NULL ||
+    GAGenealogyGetDepth(genealogy, 0) != 0 ||
+    GAGenealogyGetDepth(genealogy, 4) != 2 ||
+    GAGenealogyGetDepth(genealogy, 6) != -1 ||
+    GAGenealogyGetAncestors(genealogy, 4, &ids) != 4 ||
+    memcmp(ids, ancestors, sizeof(ancestors)) != 0 ||
+    GAGenealogyGetAncestors(genealogy, 1, &ids) != 0 ||
+    GAGenealogyGetDescendants(genealogy, 0, &ids) != 3 ||
+    memcmp(ids, descendants, sizeof(descendants)) != 0 ||
+    GAGenealogyGetDescendants(genealogy, 6, &ids) != -1) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAGenealogy failed");
+    PBErrCatch(GenAlgErr);
+  }
+  GAGenealogyFlush(genealogy);
+  if (GAGenealogyGetNbAdn(genealogy) != 0 ||
+    GAGenealogyGetBirth(genealogy, 0) != NULL) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAGenealogyFlush failed");
+    PBErrCatch(GenAlgErr);
+  }
+  GAGenealogyFree(&genealogy);
+  // Index the genealogy of a running GenAlg
+  int lengthAdnF = 4;
+  int lengthAdnI = lengthAdnF;
+  GenAlg* ga = GenAlgCreate(GENALG_NBENTITIES, GENALG_NBELITES, 
+    lengthAdnF, lengthAdnI);
+  VecFloat2D boundsF = VecFloatCreateStatic2D();
+  VecLong2D boundsI = VecLongCreateStatic2D();
+  VecSet(&boundsF, 0, -1.0); VecSet(&boundsF, 1, 1.0);
+  VecSet(&boundsI, 0, 0); VecSet(&boundsI, 1, 4);
+  for (int i = lengthAdnF; i--;) {
+    GASetBoundsAdnFloat(ga, i, &boundsF);
+    GASetBoundsAdnInt(ga, i, &boundsI);
+  }
+  GASetSeed(ga, RANDOMSEED);
+  GASetFlagHistory(ga, true);
+  GASetFlagHistoryIndex(ga, true);
+  GASetHistoryPath(ga, "./UnitTestGenAlgGenealogy.bin");
+  GAInit(ga);
+  do {
+    for (int iEnt = GAGetNbAdns(ga); iEnt--;)
+      if (GAAdnIsNew(GAAdn(ga, iEnt)))
+        GASetAdnValue(ga, GAAdn(ga, iEnt), 
+          -1.0 * evaluate(GAAdnAdnF(GAAdn(ga, iEnt)), 
+          GAAdnAdnI(GAAdn(ga, iEnt))));
+    GAStep(ga);
+  } while (GAGetCurEpoch(ga) < 200);
+  // The current adns are in the genealogy, and the ancestors of the
+  // best one are older than it
+  GAGenealogy* live = GAGetHistoryIndex(ga);
+  for (int iEnt = GAGetNbAdns(ga); iEnt--;) {
+    if (GAGenealogyGetBirth(live, GAAdnGetId(GAAdn(ga, iEnt))) == NULL) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GAGenealogy failed");
+      PBErrCatch(GenAlgErr);
+    }
+  }
+  unsigned long idBest = GAAdnGetId(GABestAdn(ga));
+  long nbAncestor = GAGenealogyGetAncestors(live, idBest, &ids);
+  if (GAGenealogyGetNbAdn(live) > (long)(ga->_nextId) || 
+    nbAncestor < GAGenealogyGetDepth(live, idBest) ||
+    GAGenealogyGetDepth(live, idBest) < 1) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAGenealogy failed");
+    PBErrCatch(GenAlgErr);
+  }
+  for (long iAncestor = 0; iAncestor < nbAncestor; ++iAncestor) {
+    if (ids[iAncestor] >= idBest ||
+      GAGenealogyGetDepth(live, ids[iAncestor]) >= 
+        GAGenealogyGetDepth(live, idBest)) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GAGenealogy failed");
+      PBErrCatch(GenAlgErr);
+    }
+  }
+  unsigned long* ancestorsLive = 
+    PBErrMalloc(GenAlgErr, sizeof(unsigned long) * nbAncestor);
+  memcpy(ancestorsLive, ids, sizeof(unsigned long) * nbAncestor);
+  // The index of the loaded history is the same
+  if (GASaveHistory(ga) == false) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GASaveHistory failed");
+    PBErrCatch(GenAlgErr);
+  }
+  GAHistory history = GAHistoryCreateStatic();
+  GAHistorySetFlagIndex(&history, true);
+  FILE* stream = fopen(GAGetHistoryPath(ga), "rb");
+  bool ret = GAHistoryLoad(&history, stream);
+  fclose(stream);
+  GAGenealogy* loaded = GAHistoryIndex(&history);
+  if (ret == false ||
+    GAGenealogyGetNbAdn(loaded) != GAGenealogyGetNbAdn(live) ||
+    GAGenealogyGetAncestors(loaded, idBest, &ids) != nbAncestor ||
+    memcmp(ids, ancestorsLive, sizeof(unsigned long) * nbAncestor) != 0 ||
+    GAGenealogyGetDescendants(loaded, 0, &ids) != 
+      GAGenealogyGetDescendants(live, 0, &ids)) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAGenealogy failed");
+    PBErrCatch(GenAlgErr);
+  }
+  free(ancestorsLive);
+  GAHistoryFree(&history);
+  GenAlgFree(&ga);
+  printf("UnitTestGenAlgGenealogy OK\n");
+}
+
+void UnitTestGenAlgAsyncIO() {
+  // Run the same GenAlg in synchronous and asynchronous mode, saving 
+  // the history and a checkpoint at each epoch
+  GenAlg* ga[2] = {NULL};
+  FILE* stream[2] = {NULL};
+  char* path[2] = {"./UnitTestGenAlgAsyncIOSync", "./UnitTestGenAlgAsyncIO"};
+  char pathFile[100];
+  for (int iGA = 0; iGA < 2; ++iGA) {
+    ga[iGA] = UnitTestGenAlgFixtureCreate(GENALG_NBENTITIES, 
+      GENALG_NBELITES, 4);
+    // Restart with the history recorded
+    GASetFlagAsyncIO(ga[iGA], (iGA == 1));
+    GASetFlagHistory(ga[iGA], true);
+    sprintf(pathFile, "%s.hist", path[iGA]);
+    GASetHistoryPath(ga[iGA], pathFile);
+    GAInit(ga[iGA]);
+    sprintf(pathFile, "%s.bin", path[iGA]);
+    stream[iGA] = fopen(pathFile, "wb");
+  }
+  if (GAGetFlagAsyncIO(ga[0]) == true || 
+    GAGetFlagAsyncIO(ga[1]) == false) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GASetFlagAsyncIO failed");
+    PBErrCatch(GenAlgErr);
+  }
+  for (int iEpoch = 0; iEpoch < 500; ++iEpoch) {
+    for (int iGA = 0; iGA < 2; ++iGA) {
+      for (int iEnt = GAGetNbAdns(ga[iGA]); iEnt--;)
+        if (GAAdnIsNew(GAAdn(ga[iGA], iEnt)))
+          GASetAdnValue(ga[iGA], GAAdn(ga[iGA], iEnt), 
+            -1.0 * evaluate(GAAdnAdnF(GAAdn(ga[iGA], iEnt)), 
+            GAAdnAdnI(GAAdn(ga[iGA], iEnt))));
+      GAStep(ga[iGA]);
+      if (GASaveCheckpoint(ga[iGA], stream[iGA]) == false) {
+        GenAlgErr->_type = PBErrTypeUnitTestFailed;
+        sprintf(GenAlgErr->_msg, "GASaveCheckpoint failed");
+        PBErrCatch(GenAlgErr);
+      }
+    }
+  }
+  // Wait for the writes and check the files are identical
+  char* str[2] = {NULL};
+  size_t size[2] = {0};
+  for (int iGA = 0; iGA < 2; ++iGA) {
+    if (GASaveHistory(ga[iGA]) == false || 
+      GASaveAsync(ga[iGA], stream[iGA], false) == false ||
+      GAWaitIO(ga[iGA]) == false) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GAWaitIO failed");
+      PBErrCatch(GenAlgErr);
+    }
+    fclose(stream[iGA]);
+  }
+  for (int iExt = 0; iExt < 2; ++iExt) {
+    for (int iGA = 0; iGA < 2; ++iGA) {
+      sprintf(pathFile, "%s.%s", path[iGA], (iExt == 0 ? "bin" : "hist"));
+      FILE* fp = fopen(pathFile, "rb");
+      FILE* mem = open_memstream(str + iGA, size + iGA);
+      int c = 0;
+      while ((c = fgetc(fp)) != EOF)
+        fputc(c, mem);
+      fclose(mem);
+      fclose(fp);
+    }
+    if (size[0] == 0 || size[0] != size[1] || 
+      memcmp(str[0], str[1], size[0]) != 0) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GASetFlagAsyncIO failed");
+      PBErrCatch(GenAlgErr);
+    }
+    free(str[0]);
+    free(str[1]);
+  }
+  // A failed write is reported by GAWaitIO, once
+  sprintf(pathFile, "%s.bin", path[1]);
+  FILE* fp = fopen(pathFile, "rb");
+  if (GASaveAsync(ga[1], fp, true) == false || 
+    GAWaitIO(ga[1]) == true || GAWaitIO(ga[1]) == false) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAWaitIO failed");
+    PBErrCatch(GenAlgErr);
+  }
+  // After a failed checkpoint, the next one is a full snapshot
+  if (GASaveCheckpoint(ga[1], fp) == false || GAWaitIO(ga[1]) == true) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAWaitIO failed");
+    PBErrCatch(GenAlgErr);
+  }
+  char* data = NULL;
+  size_t sizeData = 0;
+  FILE* mem = open_memstream(&data, &sizeData);
+  if (GASaveCheckpoint(ga[1], mem) == false || 
+    GAWaitIO(ga[1]) == false) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAWaitIO failed");
+    PBErrCatch(GenAlgErr);
+  }
+  fclose(mem);
+  if (sizeData < sizeof(GENALG_SNAPSHOT_MAGIC) || 
+    memcmp(data, GENALG_SNAPSHOT_MAGIC, 
+      sizeof(GENALG_SNAPSHOT_MAGIC)) != 0) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAWaitIO failed");
+    PBErrCatch(GenAlgErr);
+  }
+  free(data);
+  // A failed write is still reported after turning the flag off
+  if (GASaveAsync(ga[1], fp, true) == false) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GASaveAsync failed");
+    PBErrCatch(GenAlgErr);
+  }
+  GASetFlagAsyncIO(ga[1], false);
+  if (GAGetFlagAsyncIO(ga[1]) == true || 
+    GAWaitIO(ga[1]) == true || GAWaitIO(ga[1]) == false) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GASetFlagAsyncIO failed");
+    PBErrCatch(GenAlgErr);
+  }
+  fclose(fp);
+  GenAlgFree(ga);
+  GenAlgFree(ga + 1);
+  printf("UnitTestGenAlgAsyncIO OK\n");
+}
+
+void UnitTestGenAlgContiguousAdn() {
+  int lengthAdnF = 4;
+  int lengthAdnI = lengthAdnF;
+  GenAlg* ga = UnitTestGenAlgFixtureCreate(GENALG_NBENTITIES, 
+    GENALG_NBELITES, lengthAdnF);
+  VecFloat* adnF = VecFloatCreate(lengthAdnF);
+  VecLong* adnI = VecLongCreate(lengthAdnI);
+  VecCopy(adnF, GAAdnAdnF(GAAdn(ga, 1)));
+  VecCopy(adnI, GAAdnAdnI(GAAdn(ga, 1)));
+  GASetFlagContiguousAdn(ga, true);
+  if (GAGetFlagContiguousAdn(ga) != true ||
+    GAAdn(ga, 1)->_iRow < 0 ||
+    ((size_t)GAAdnAdnF(GAAdn(ga, 1)) % GENALG_STORE_ALIGN) != 0 ||
+    VecIsEqual(GAAdnAdnF(GAAdn(ga, 1)), adnF) == false ||
+    VecIsEqual(GAAdnAdnI(GAAdn(ga, 1)), adnI) == false) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GASetFlagContiguousAdn failed");
+    PBErrCatch(GenAlgErr);
+  }
+  for (int iEpoch = 0; iEpoch < 10; ++iEpoch) {
+    for (int iEnt = GAGetNbAdns(ga); iEnt--;)
+      if (GAAdnIsNew(GAAdn(ga, iEnt)))
+        GASetAdnValue(ga, GAAdn(ga, iEnt), 
+          -1.0 * evaluate(GAAdnAdnF(GAAdn(ga, iEnt)), 
+          GAAdnAdnI(GAAdn(ga, iEnt))));
+    GAStep(ga);
+  }
+  VecCopy(adnF, GAAdnAdnF(GAAdn(ga, 0)));
+  VecCopy(adnI, GAAdnAdnI(GAAdn(ga, 0)));
+  GASetNbEntities(ga, 4 * GENALG_NBENTITIES);
+  if (GAGetNbAdns(ga) != 4 * GENALG_NBENTITIES ||
+    ga->_store->_nbRow < 4 * GENALG_NBENTITIES ||
+    VecIsEqual(GAAdnAdnF(GAAdn(ga, 0)), adnF) == false ||
+    VecIsEqual(GAAdnAdnI(GAAdn(ga, 0)), adnI) == false) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAAdnStoreReserve failed");
+    PBErrCatch(GenAlgErr);
+  }
+  GASetFlagContiguousAdn(ga, false);
+  if (GAGetFlagContiguousAdn(ga) != false ||
+    GAAdn(ga, 0)->_iRow != -1 ||
+    VecIsEqual(GAAdnAdnF(GAAdn(ga, 0)), adnF) == false ||
+    VecIsEqual(GAAdnAdnI(GAAdn(ga, 0)), adnI) == false) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GASetFlagContiguousAdn failed");
+    PBErrCatch(GenAlgErr);
+  }
+  VecFree(&adnF);
+  VecFree(&adnI);
+  GenAlgFree(&ga);
+  printf("UnitTestGenAlgContiguousAdn OK\n");
+}
+
+void UnitTestGenAlgRanks() {
+  GenAlg* ga = UnitTestGenAlgFixtureCreate(GENALG_NBENTITIES, 
+    GENALG_NBELITES, 4);
+  GASetNbMinAdn(ga, GENALG_NBELITES * 2);
+  GASetNbMaxAdn(ga, 2 * GENALG_NBENTITIES);
+  for (int iEpoch = 0; iEpoch < 10; ++iEpoch) {
+    for (int iEnt = GAGetNbAdns(ga); iEnt--;)
+      if (GAAdnIsNew(GAAdn(ga, iEnt)))
+        GASetAdnValue(ga, GAAdn(ga, iEnt), 
+          -1.0 * evaluate(GAAdnAdnF(GAAdn(ga, iEnt)), 
+          GAAdnAdnI(GAAdn(ga, iEnt))));
+    GAStep(ga);
+    GSetIterBackward iter = GSetIterBackwardCreateStatic(GAAdns(ga));
+    int iRank = 0;
+    do {
+      if (GAAdn(ga, iRank) != GSetIterGet(&iter) ||
+        GAAdn(ga, iRank)->_rank != iRank) {
+        GenAlgErr->_type = PBErrTypeUnitTestFailed;
+        sprintf(GenAlgErr->_msg, "GAUpdateRanks failed");
+        PBErrCatch(GenAlgErr);
+      }
+      ++iRank;
+    } while (GSetIterStep(&iter));
+    if (iRank != GAGetNbAdns(ga)) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GAUpdateRanks failed");
+      PBErrCatch(GenAlgErr);
+    }
+  }
+  GASetAdnValue(ga, GAAdn(ga, 1), 10.0);
+  if (ISEQUALF(ga->_ranks[1]->_sortVal, 10.0) == false) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GASetAdnValue failed");
+    PBErrCatch(GenAlgErr);
+  }
+  GenAlgFree(&ga);
+  printf("UnitTestGenAlgRanks OK\n");
+}
+
+void UnitTestGenAlgSelectBest() {
+  srandom(0);
+  int nbAdn = 200;
+  GenAlg* ga = GenAlgCreate(nbAdn, GENALG_NBELITES, 1, 0);
+  GASetNbMaxAdn(ga, nbAdn);
+  GARng rng = GARngCreateStatic(0, 1);
+  GenAlgAdn** sorted = PBErrMalloc(GenAlgErr, 
+    sizeof(GenAlgAdn*) * nbAdn);
+  int nbBest[4] = {0, GENALG_NBELITES, nbAdn - 1, 2 * nbAdn};
+  for (int iTest = 0; iTest < 4; ++iTest) {
+    // Set values with many duplicates
+    for (int iRank = nbAdn; iRank--;)
+      GASetAdnValue(ga, GAAdn(ga, iRank), 
+        floor(GARngUnif(&rng) * 20.0));
+    // Get the order of a stable sort, from the best
+    GSetIterBackward iter = GSetIterBackwardCreateStatic(GAAdns(ga));
+    int nbSorted = 0;
+    do {
+      GenAlgAdn* adn = GSetIterGet(&iter);
+      int iPos = nbSorted;
+      while (iPos > 0 && 
+        GAAdnGetVal(sorted[iPos - 1]) < GAAdnGetVal(adn)) {
+        sorted[iPos] = sorted[iPos - 1];
+        --iPos;
+      }
+      sorted[iPos] = adn;
+      ++nbSorted;
+    } while (GSetIterStep(&iter));
+    GASelectBest(ga, nbBest[iTest]);
+    float sum = 0.0;
+    float sumSorted = 0.0;
+    for (int iRank = 0; iRank < nbAdn; ++iRank) {
+      if ((iRank < nbBest[iTest] && 
+        GAAdn(ga, iRank) != sorted[iRank]) || 
+        GAAdn(ga, iRank)->_rank != iRank ||
+        ISEQUALF(ga->_ranks[iRank]->_sortVal, 
+          GAAdnGetVal(GAAdn(ga, iRank))) == false ||
+        (iRank >= nbBest[iTest] && nbBest[iTest] > 0 &&
+        GAAdnGetVal(GAAdn(ga, iRank)) > 
+        GAAdnGetVal(GAAdn(ga, nbBest[iTest] - 1)))) {
+        GenAlgErr->_type = PBErrTypeUnitTestFailed;
+        sprintf(GenAlgErr->_msg, "GASelectBest failed");
+        PBErrCatch(GenAlgErr);
+      }
+      sum += GAAdnGetVal(GAAdn(ga, iRank));
+      sumSorted += GAAdnGetVal(sorted[iRank]);
+    }
+    if (GAGetNbAdns(ga) != nbAdn || ISEQUALF(sum, sumSorted) == false) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GASelectBest failed");
+      PBErrCatch(GenAlgErr);
+    }
+  }
+  free(sorted);
+  GenAlgFree(&ga);
+  printf("UnitTestGenAlgSelectBest OK\n");
+}
+
+float UnitTestGenAlgEvaluateFun(const GenAlgAdn* const adn, 
+  void* const data, const int iThread) {
+  // Count the evaluations per thread
+  ((int*)data)[iThread] += 1;
+  return -1.0 * evaluate(GAAdnAdnF(adn), GAAdnAdnI(adn));
+}
+
+void UnitTestGenAlgEvaluate() {
+  // Run the same GenAlg with a sequential evaluation and with 
+  // GAEvaluate, results must be identical
+  GenAlg* gaRef = UnitTestGenAlgFixtureCreate(GENALG_NBENTITIES, 
+    GENALG_NBELITES, 4);
+  GenAlg* ga = UnitTestGenAlgFixtureCreate(GENALG_NBENTITIES, 
+    GENALG_NBELITES, 4);
+  int nbThread = 4;
+  int count[4] = {0};
+  for (int iEpoch = 0; iEpoch < 10; ++iEpoch) {
+    int nbNew = 0;
+    for (int iEnt = GAGetNbAdns(gaRef); iEnt--;)
+      if (GAAdnIsNew(GAAdn(gaRef, iEnt))) {
+        GASetAdnValue(gaRef, GAAdn(gaRef, iEnt), 
+          -1.0 * evaluate(GAAdnAdnF(GAAdn(gaRef, iEnt)), 
+          GAAdnAdnI(GAAdn(gaRef, iEnt))));
+        ++nbNew;
+      }
+    for (int iThread = nbThread; iThread--;)
+      count[iThread] = 0;
+    GAEvaluate(ga, UnitTestGenAlgEvaluateFun, count, nbThread);
+    if (count[0] + count[1] + count[2] + count[3] != nbNew) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GAEvaluate failed");
+      PBErrCatch(GenAlgErr);
+    }
+    for (int iEnt = GAGetNbAdns(ga); iEnt--;)
+      if (ISEQUALF(GAAdnGetVal(GAAdn(ga, iEnt)), 
+        GAAdnGetVal(GAAdn(gaRef, iEnt))) == false ||
+        ISEQUALF(GSetElemGetSortVal(ga->_ranks[iEnt]), 
+        GAAdnGetVal(GAAdn(ga, iEnt))) == false) {
+        GenAlgErr->_type = PBErrTypeUnitTestFailed;
+        sprintf(GenAlgErr->_msg, "GAEvaluate failed");
+        PBErrCatch(GenAlgErr);
+      }
+    GAStep(gaRef);
+    GAStep(ga);
+  }
+  if (ga->_pool == NULL || 
+    GAThreadPoolGetNbThread(ga->_pool) != nbThread) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAEvaluate failed");
+    PBErrCatch(GenAlgErr);
+  }
+  GenAlgFree(&gaRef);
+  GenAlgFree(&ga);
+  printf("UnitTestGenAlgEvaluate OK\n");
+}
+
+void UnitTestGenAlgStepThread() {
+  // Run the same GenAlg with one and several threads, results must 
+  // be identical
+  GenAlg* gaRef = UnitTestGenAlgFixtureCreate(GENALG_NBENTITIES, 
+    GENALG_NBELITES, 4);
+  GenAlg* ga = UnitTestGenAlgFixtureCreate(GENALG_NBENTITIES, 
+    GENALG_NBELITES, 4);
+  GASetNbThread(ga, 4);
+  if (GAGetNbThread(ga) != 4) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GASetNbThread failed");
+    PBErrCatch(GenAlgErr);
+  }
+  int count[4] = {0};
+  for (int iEpoch = 0; iEpoch < 10; ++iEpoch) {
+    GAEvaluate(gaRef, UnitTestGenAlgEvaluateFun, count, 1);
+    GAEvaluate(ga, UnitTestGenAlgEvaluateFun, count, 4);
+    GAStep(gaRef);
+    GAStep(ga);
+    if (GAGetNbAdns(ga) != GAGetNbAdns(gaRef) || 
+      ga->_nextId != gaRef->_nextId) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GAStep failed");
+      PBErrCatch(GenAlgErr);
+    }
+    for (int iEnt = GAGetNbAdns(ga); iEnt--;) {
+      GenAlgAdn* adn = GAAdn(ga, iEnt);
+      GenAlgAdn* adnRef = GAAdn(gaRef, iEnt);
+      if (GAAdnGetId(adn) != GAAdnGetId(adnRef) ||
+        VecIsEqual(GAAdnAdnF(adn), GAAdnAdnF(adnRef)) == false ||
+        VecIsEqual(GAAdnAdnI(adn), GAAdnAdnI(adnRef)) == false) {
+        GenAlgErr->_type = PBErrTypeUnitTestFailed;
+        sprintf(GenAlgErr->_msg, "GAStep failed");
+        PBErrCatch(GenAlgErr);
+      }
+    }
+  }
+  GenAlgFree(&gaRef);
+  GenAlgFree(&ga);
+  printf("UnitTestGenAlgStepThread OK\n");
+}
+
+float UnitTestGenAlgScratchFun(const GenAlgAdn* const adn, 
+  void* const data, const int iThread) {
+  (void)data; (void)iThread;
+  float val = 0.0;
+  for (long iGene = VecGetDim(GAAdnAdnF(adn)); iGene--;)
+    val += GAAdnGetGeneF(adn, iGene) * (float)GAAdnGetGeneI(adn, iGene);
+  return val;
+}
+
+GenAlg* UnitTestGenAlgScratchCreate(const int nbThread) {
+  int nbIn = 3;
+  int nbHid = 4;
+  int nbOut = 2;
+  int nbBase = 6;
+  // Restart as a NeuraNet GenAlg with the bounds of its int genes
+  GenAlg* ga = UnitTestGenAlgFixtureCreate(GENALG_NBENTITIES, 
+    GENALG_NBELITES, 3 * nbBase);
+  GASetTypeNeuraNet(ga, nbIn, nbHid, nbOut);
+  VecLong2D boundsI[3] = {VecLongCreateStatic2D(), 
+    VecLongCreateStatic2D(), VecLongCreateStatic2D()};
+  VecSet(boundsI, 0, -1); VecSet(boundsI, 1, nbBase - 1);
+  VecSet(boundsI + 1, 0, 0); VecSet(boundsI + 1, 1, nbIn + nbHid - 1);
+  VecSet(boundsI + 2, 0, nbIn); 
+  VecSet(boundsI + 2, 1, nbIn + nbHid + nbOut - 1);
+  for (int iGene = 3 * nbBase; iGene--;)
+    GASetBoundsAdnInt(ga, iGene, boundsI + iGene % 3);
+  GAInit(ga);
+  GASetNbThread(ga, nbThread);
+  return ga;
+}
+
+void UnitTestGenAlgScratch() {
+  // Run the same NeuraNet GenAlg with one and several threads, the 
+  // scratch memory of each thread must be allocated once and the 
+  // results must be identical
+  GenAlg* gaRef = UnitTestGenAlgScratchCreate(1);
+  GenAlg* ga = UnitTestGenAlgScratchCreate(3);
+  char* isUsed[3] = {NULL};
+  for (int iEpoch = 0; iEpoch < 10; ++iEpoch) {
+    GAEvaluate(gaRef, UnitTestGenAlgScratchFun, NULL, 1);
+    GAEvaluate(ga, UnitTestGenAlgScratchFun, NULL, 3);
+    GAStep(gaRef);
+    GAStep(ga);
+    if (ga->_nbScratch != 3 || gaRef->_nbScratch != 1) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GAPrepareScratch failed");
+      PBErrCatch(GenAlgErr);
+    }
+    for (int iThread = 3; iThread--;) {
+      if (ga->_scratch[iThread]._nbIsUsed != 7 ||
+        (iEpoch > 0 && ga->_scratch[iThread]._isUsed != isUsed[iThread])) {
+        GenAlgErr->_type = PBErrTypeUnitTestFailed;
+        sprintf(GenAlgErr->_msg, "GAPrepareScratch failed");
+        PBErrCatch(GenAlgErr);
+      }
+      isUsed[iThread] = ga->_scratch[iThread]._isUsed;
+    }
+    for (int iEnt = GAGetNbAdns(ga); iEnt--;) {
+      GenAlgAdn* adn = GAAdn(ga, iEnt);
+      GenAlgAdn* adnRef = GAAdn(gaRef, iEnt);
+      if (GAAdnGetId(adn) != GAAdnGetId(adnRef) ||
+        VecIsEqual(GAAdnAdnF(adn), GAAdnAdnF(adnRef)) == false ||
+        VecIsEqual(GAAdnAdnI(adn), GAAdnAdnI(adnRef)) == false) {
+        GenAlgErr->_type = PBErrTypeUnitTestFailed;
+        sprintf(GenAlgErr->_msg, "GAMuteNeuraNet failed");
+        PBErrCatch(GenAlgErr);
+      }
+    }
+  }
+  GenAlgFree(&gaRef);
+  GenAlgFree(&ga);
+  printf("UnitTestGenAlgScratch OK\n");
+}
+
+GAIslands* UnitTestGenAlgIslandsCreate(const int nbIsland) {
+  GAIslands* islands = GAIslandsCreate(nbIsland, GENALG_NBENTITIES, 
+    GENALG_NBELITES, 4, 4);
+  for (int iIsland = nbIsland; iIsland--;)
+    UnitTestGenAlgSetBounds(GAIslandsGenAlg(islands, iIsland));
+  GAIslandsSetSeed(islands, 1);
+  GAIslandsInit(islands);
+  return islands;
+}
+
+void UnitTestGenAlgIslands() {
+  int nbIsland = 4;
+  GAIslands* islands = UnitTestGenAlgIslandsCreate(nbIsland);
+  if (GAIslandsGetNbIsland(islands) != nbIsland ||
+    GAIslandsGetTopology(islands) != gaMigrationRing ||
+    GAIslandsGetPeriod(islands) != 10 ||
+    GAIslandsGetNbMigrant(islands) != 1 ||
+    GAIslandsGetNbMigration(islands) != 0) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAIslandsCreate failed");
+    PBErrCatch(GenAlgErr);
+  }
+  // Without migrant, the islands must evolve as independant GenAlg
+  GAIslandsSetNbMigrant(islands, 0);
+  GAIslandsSetPeriod(islands, 5);
+  if (GAIslandsGetNbMigrant(islands) != 0 ||
+    GAIslandsGetPeriod(islands) != 5) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAIslandsSet failed");
+    PBErrCatch(GenAlgErr);
+  }
+  GAIslands* refs = UnitTestGenAlgIslandsCreate(nbIsland);
+  int count[4] = {0};
+  for (int iStep = 0; iStep < 3; ++iStep) {
+    GAIslandsStep(islands, UnitTestGenAlgEvaluateFun, count);
+    for (int iIsland = nbIsland; iIsland--;) {
+      GenAlg* ref = GAIslandsGenAlg(refs, iIsland);
+      for (int iEpoch = 5; iEpoch--;) {
+        GAEvaluate(ref, UnitTestGenAlgEvaluateFun, count, 1);
+        GAStep(ref);
+      }
+      GenAlg* ga = GAIslandsGenAlg(islands, iIsland);
+      if (GAGetNbAdns(ga) != GAGetNbAdns(ref) ||
+        GAGetCurEpoch(ga) != GAGetCurEpoch(ref)) {
+        GenAlgErr->_type = PBErrTypeUnitTestFailed;
+        sprintf(GenAlgErr->_msg, "GAIslandsStep failed");
+        PBErrCatch(GenAlgErr);
+      }
+      for (int iEnt = GAGetNbAdns(ga); iEnt--;) {
+        GenAlgAdn* adn = GAAdn(ga, iEnt);
+        GenAlgAdn* adnRef = GAAdn(ref, iEnt);
+        if (GAAdnGetId(adn) != GAAdnGetId(adnRef) ||
+          VecIsEqual(GAAdnAdnF(adn), GAAdnAdnF(adnRef)) == false ||
+          VecIsEqual(GAAdnAdnI(adn), GAAdnAdnI(adnRef)) == false) {
+          GenAlgErr->_type = PBErrTypeUnitTestFailed;
+          sprintf(GenAlgErr->_msg, "GAIslandsStep failed");
+          PBErrCatch(GenAlgErr);
+        }
+      }
+    }
+  }
+  GAIslandsFree(&refs);
+  // Ring topology, the best adns of each island replace the worst 
+  // ones of the next island
+  GAIslandsSetNbMigrant(islands, 2);
+  GAIslandsStep(islands, UnitTestGenAlgEvaluateFun, count);
+  for (int iDst = nbIsland; iDst--;) {
+    GenAlg* dst = GAIslandsGenAlg(islands, iDst);
+    GenAlg* src = 
+      GAIslandsGenAlg(islands, (iDst + nbIsland - 1) % nbIsland);
+    for (int iMigrant = 2; iMigrant--;) {
+      GenAlgAdn* adn = GAAdn(dst, GAGetNbAdns(dst) - 1 - iMigrant);
+      GenAlgAdn* migrant = GAAdn(src, iMigrant);
+      if (VecIsEqual(GAAdnAdnF(adn), GAAdnAdnF(migrant)) == false ||
+        VecIsEqual(GAAdnAdnI(adn), GAAdnAdnI(migrant)) == false ||
+        ISEQUALF(GAAdnGetVal(adn), GAAdnGetVal(migrant)) == false ||
+        GAAdnIsNew(adn) == true || GAAdnGetAge(adn) != 1 ||
+        GAAdnGetId(adn) != dst->_nextId - 2 + (unsigned long)iMigrant) {
+        GenAlgErr->_type = PBErrTypeUnitTestFailed;
+        sprintf(GenAlgErr->_msg, "GAIslandsStep failed (ring)");
+        PBErrCatch(GenAlgErr);
+      }
+    }
+  }
+  // All to all topology, each island receives the best adn of all the
+  // other ones
+  GAIslandsSetTopology(islands, gaMigrationAllToAll);
+  GAIslandsSetNbMigrant(islands, 1);
+  GAIslandsStep(islands, UnitTestGenAlgEvaluateFun, count);
+  for (int iDst = nbIsland; iDst--;) {
+    GenAlg* dst = GAIslandsGenAlg(islands, iDst);
+    for (int iSrc = 1; iSrc < nbIsland; ++iSrc) {
+      GenAlg* src = 
+        GAIslandsGenAlg(islands, (iDst + nbIsland - iSrc) % nbIsland);
+      GenAlgAdn* adn = GAAdn(dst, GAGetNbAdns(dst) - iSrc);
+      if (VecIsEqual(GAAdnAdnF(adn), GAAdnAdnF(GAAdn(src, 0))) == false ||
+        VecIsEqual(GAAdnAdnI(adn), GAAdnAdnI(GAAdn(src, 0))) == false) {
+        GenAlgErr->_type = PBErrTypeUnitTestFailed;
+        sprintf(GenAlgErr->_msg, "GAIslandsStep failed (all to all)");
+        PBErrCatch(GenAlgErr);
+      }
+    }
+  }
+  if (GAIslandsGetTopology(islands) != gaMigrationAllToAll ||
+    GAIslandsGetNbMigration(islands) != 5) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAIslandsStep failed");
+    PBErrCatch(GenAlgErr);
+  }
+  // The best adn is the best of the islands' best adns
+  const GenAlgAdn* best = GAIslandsBestAdn(islands);
+  for (int iIsland = nbIsland; iIsland--;) {
+    if (GAAdnGetVal(GABestAdn(GAIslandsGenAlg(islands, iIsland))) > 
+      GAAdnGetVal(best)) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GAIslandsBestAdn failed");
+      PBErrCatch(GenAlgErr);
+    }
+  }
+  GAIslandsFree(&islands);
+  if (islands != NULL) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAIslandsFree failed");
+    PBErrCatch(GenAlgErr);
+  }
+  printf("UnitTestGenAlgIslands OK\n");
+}
+
+void* UnitTestGenAlgSteadyStateWorker(void* data) {
+  GenAlg* ga = (GenAlg*)data;
+  for (int iChild = 500; iChild--;) {
+    GenAlgAdn* child = GAGetSteadyChild(ga);
+    float val = -1.0 * evaluate(GAAdnAdnF(child), GAAdnAdnI(child));
+    GASetSteadyChildValue(ga, child, val);
+  }
+  return NULL;
+}
+
+void UnitTestGenAlgSteadyStateCheck(const GenAlg* const ga) {
+  int nbDead = 0;
+  for (int iRank = 0; iRank < GAGetNbAdns(ga); ++iRank) {
+    if (GAAdn(ga, iRank)->_rank != iRank ||
+      (iRank > 0 && 
+      GAAdnGetVal(GAAdn(ga, iRank)) > GAAdnGetVal(GAAdn(ga, iRank - 1)))) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GASetSteadyChildValue failed (rank)");
+      PBErrCatch(GenAlgErr);
+    }
+    if (GAAdnGetVal(GAAdn(ga, iRank)) <= -FLT_MAX)
+      ++nbDead;
+  }
+  if (nbDead != ga->_steady->_nbDead ||
+    GAAdnGetVal(GABestAdn(ga)) < GAAdnGetVal(GAAdn(ga, 0))) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GASetSteadyChildValue failed");
+    PBErrCatch(GenAlgErr);
+  }
+}
+
+void UnitTestGenAlgSteadyState() {
+  GenAlg* ga = UnitTestGenAlgFixtureCreate(GENALG_NBENTITIES, 
+    GENALG_NBELITES, 4);
+  int count[1] = {0};
+  GAEvaluate(ga, UnitTestGenAlgEvaluateFun, count, 1);
+  GASetFlagSteadyState(ga, true);
+  if (GAGetFlagSteadyState(ga) == false ||
+    ISEQUALF(GAAdnGetVal(GABestAdn(ga)), 
+    GAAdnGetVal(GAAdn(ga, 0))) == false) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GASetFlagSteadyState failed");
+    PBErrCatch(GenAlgErr);
+  }
+  float bestInit = GAAdnGetVal(GABestAdn(ga));
+  unsigned long epochInit = GAGetCurEpoch(ga);
+  // Evaluate the children from several threads
+  pthread_t threads[4];
+  for (int iThread = 4; iThread--;)
+    pthread_create(threads + iThread, NULL, 
+      UnitTestGenAlgSteadyStateWorker, ga);
+  for (int iThread = 4; iThread--;)
+    pthread_join(threads[iThread], NULL);
+  UnitTestGenAlgSteadyStateCheck(ga);
+  int nbChildEpoch = GAGetNbAdns(ga) - GAGetNbElites(ga);
+  if (GAGetNbAdns(ga) != GENALG_NBENTITIES ||
+    GAGetCurEpoch(ga) != epochInit + 2000 / nbChildEpoch ||
+    ga->_steady->_nbAsked != 2000 ||
+    GSetNbElem(&(ga->_steady->_spares)) > 4 ||
+    GAAdnGetVal(GABestAdn(ga)) <= bestInit) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GASetSteadyChildValue failed");
+    PBErrCatch(GenAlgErr);
+  }
+  // Force the KT events
+  unsigned long nbKTEvent = GAGetNbKTEvent(ga);
+  GASetDiversityThreshold(ga, 1e9);
+  for (int iChild = 0; iChild < 5 * nbChildEpoch; ++iChild) {
+    GenAlgAdn* child = GAGetSteadyChild(ga);
+    GASetSteadyChildValue(ga, child, 
+      -1.0 * evaluate(GAAdnAdnF(child), GAAdnAdnI(child)));
+    UnitTestGenAlgSteadyStateCheck(ga);
+  }
+  if (GAGetNbKTEvent(ga) <= nbKTEvent) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GASetSteadyChildValue failed (KT event)");
+    PBErrCatch(GenAlgErr);
+  }
+  GASetFlagSteadyState(ga, false);
+  if (GAGetFlagSteadyState(ga) == true) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GASetFlagSteadyState failed");
+    PBErrCatch(GenAlgErr);
+  }
+  GenAlgFree(&ga);
+  printf("UnitTestGenAlgSteadyState OK\n");
+}
+
+void UnitTestGenAlgAskTellEval(const GABatch* const batch, 
+  float* const scores) {
+  VecFloat* adnF = VecFloatCreate(4);
+  VecLong* adnI = VecLongCreate(4);
+  for (long iCandidate = GABatchGetNb(batch); iCandidate--;) {
+    for (int iGene = 4; iGene--;) {
+      VecSet(adnF, iGene, GABatchAdnF(batch, iCandidate)[iGene]);
+      VecSet(adnI, iGene, GABatchAdnI(batch, iCandidate)[iGene]);
+    }
+    scores[iCandidate] = -1.0 * evaluate(adnF, adnI);
+  }
+  VecFree(&adnF);
+  VecFree(&adnI);
+}
+
+void UnitTestGenAlgAskTell() {
+  // Run the same GenAlg with GAEvaluate and with the ask/tell 
+  // interface, results must be identical
+  GenAlg* gaRef = UnitTestGenAlgFixtureCreate(GENALG_NBENTITIES, 
+    GENALG_NBELITES, 4);
+  GenAlg* ga = UnitTestGenAlgFixtureCreate(GENALG_NBENTITIES, 
+    GENALG_NBELITES, 4);
+  int count[1] = {0};
+  float scores[2][7];
+  for (int iEpoch = 0; iEpoch < 10; ++iEpoch) {
+    GAEvaluate(gaRef, UnitTestGenAlgEvaluateFun, count, 1);
+    GAStep(gaRef);
+    // Evaluate two batches at the same time, and give them back in 
+    // the reverse order
+    bool stepped = false;
+    do {
+      GABatch* batches[2] = {GAAsk(ga, 7), GAAsk(ga, 7)};
+      for (int iBatch = 2; iBatch--;) {
+        GABatch* batch = batches[iBatch];
+        if (GABatchGetNb(batch) > 7 || (iBatch == 0 && 
+          GABatchGetNb(batch) == 0)) {
+          GenAlgErr->_type = PBErrTypeUnitTestFailed;
+          sprintf(GenAlgErr->_msg, "GAAsk failed");
+          PBErrCatch(GenAlgErr);
+        }
+        for (long iCandidate = GABatchGetNb(batch); iCandidate--;) {
+          GenAlgAdn* adn = batch->_adns[iCandidate];
+          if (GABatchGetId(batch, iCandidate) != GAAdnGetId(adn) ||
+            GAAdnIsNew(adn) == false ||
+            memcmp(GABatchAdnF(batch, iCandidate), 
+            GAAdnAdnF(adn)->_val, sizeof(float) * 4) != 0 ||
+            memcmp(GABatchAdnI(batch, iCandidate), 
+            GAAdnAdnI(adn)->_val, sizeof(long) * 4) != 0) {
+            GenAlgErr->_type = PBErrTypeUnitTestFailed;
+            sprintf(GenAlgErr->_msg, "GAAsk failed");
+            PBErrCatch(GenAlgErr);
+          }
+        }
+        UnitTestGenAlgAskTellEval(batch, scores[iBatch]);
+      }
+      for (int iBatch = 2; iBatch--;)
+        stepped |= GATell(ga, batches + iBatch, scores[iBatch]);
+      if (batches[0] != NULL || batches[1] != NULL) {
+        GenAlgErr->_type = PBErrTypeUnitTestFailed;
+        sprintf(GenAlgErr->_msg, "GATell failed");
+        PBErrCatch(GenAlgErr);
+      }
+    } while (stepped == false);
+    if (GAGetNbAdns(ga) != GAGetNbAdns(gaRef) || 
+      GAGetCurEpoch(ga) != GAGetCurEpoch(gaRef)) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GATell failed");
+      PBErrCatch(GenAlgErr);
+    }
+    for (int iEnt = GAGetNbAdns(ga); iEnt--;) {
+      GenAlgAdn* adn = GAAdn(ga, iEnt);
+      GenAlgAdn* adnRef = GAAdn(gaRef, iEnt);
+      if (GAAdnGetId(adn) != GAAdnGetId(adnRef) ||
+        VecIsEqual(GAAdnAdnF(adn), GAAdnAdnF(adnRef)) == false ||
+        VecIsEqual(GAAdnAdnI(adn), GAAdnAdnI(adnRef)) == false) {
+        GenAlgErr->_type = PBErrTypeUnitTestFailed;
+        sprintf(GenAlgErr->_msg, "GATell failed");
+        PBErrCatch(GenAlgErr);
+      }
+    }
+  }
+  // A batch is empty while the last candidates of the epoch are 
+  // evaluated, and the scores of a previous epoch are ignored
+  GABatch* batch = GAAsk(ga, 1000);
+  GABatch* empty = GAAsk(ga, 1000);
+  if (GABatchGetNb(empty) != 0 || GATell(ga, &empty, NULL) == true) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAAsk failed");
+    PBErrCatch(GenAlgErr);
+  }
+  GAEvaluate(ga, UnitTestGenAlgEvaluateFun, count, 1);
+  GAStep(ga);
+  float* stale = PBErrMalloc(GenAlgErr, 
+    sizeof(float) * GABatchGetNb(batch));
+  UnitTestGenAlgAskTellEval(batch, stale);
+  if (GATell(ga, &batch, stale) == true) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GATell failed");
+    PBErrCatch(GenAlgErr);
+  }
+  free(stale);
+  // After a direct GAStep or GAInit, GAAsk gives the new adns of the 
+  // new population and the batches given before are ignored, even if
+  // they have the same epoch
+  for (int iReset = 0; iReset < 2; ++iReset) {
+    batch = GAAsk(ga, 1000);
+    if (iReset == 0)
+      GAStep(ga);
+    else
+      GAInit(ga);
+    GABatch* fresh = GAAsk(ga, 1000);
+    stale = PBErrMalloc(GenAlgErr, sizeof(float) * GABatchGetNb(batch));
+    UnitTestGenAlgAskTellEval(batch, stale);
+    if (GABatchGetNb(fresh) == 0 || GATell(ga, &batch, stale) == true) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GATell failed");
+      PBErrCatch(GenAlgErr);
+    }
+    for (long iCandidate = GABatchGetNb(fresh); iCandidate--;) {
+      GenAlgAdn* adn = fresh->_adns[iCandidate];
+      if (GAAdnIsNew(adn) == false || 
+        GAAdnGetId(adn) != GABatchGetId(fresh, iCandidate)) {
+        GenAlgErr->_type = PBErrTypeUnitTestFailed;
+        sprintf(GenAlgErr->_msg, "GAAsk failed");
+        PBErrCatch(GenAlgErr);
+      }
+    }
+    free(stale);
+    GABatchFree(&fresh);
+  }
+  GenAlgFree(&gaRef);
+  GenAlgFree(&ga);
+  printf("UnitTestGenAlgAskTell OK\n");
+}
+
+void UnitTestGenAlgEvaluateMatrixFun(const GAGenesMatrix* const genes,
+  float* const scores, void* const data) {
+  // Same as evaluate() with the inner loop over the candidates
+  long nbCol = GAGenesMatrixGetStride(genes);
+  float* res = PBErrMalloc(GenAlgErr, sizeof(float) * nbCol);
+  float* y = PBErrMalloc(GenAlgErr, sizeof(float) * nbCol);
+  for (long iCol = nbCol; iCol--;)
+    res[iCol] = 0.0;
+  float delta = 0.02;
+  int nb = (int)round(4.0 / delta);
+  float x = -2.0;
+  for (int i = 0; i < nb; ++i, x += delta) {
+    for (long iCol = nbCol; iCol--;)
+      y[iCol] = 0.0;
+    for (int j = 4; j--;) {
+      const float* adnF = GAGenesMatrixAdnF(genes, j);
+      const long* adnI = GAGenesMatrixAdnI(genes, j);
+      for (long iCol = 0; iCol < nbCol; ++iCol)
+        y[iCol] += adnF[iCol] * fastpow(x, adnI[iCol]);
+    }
+    float target = ftarget(x);
+    for (long iCol = 0; iCol < nbCol; ++iCol)
+      res[iCol] += fabs(target - y[iCol]);
+  }
+  for (long iCol = 0; iCol < nbCol; ++iCol)
+    scores[iCol] = -1.0 * (res[iCol] / (float)nb);
+  free(res);
+  free(y);
+  *(long*)data += GAGenesMatrixGetNb(genes);
+}
+
+void UnitTestGenAlgEvaluateMatrix() {
+  // Run the same GenAlg with GAEvaluate and GAEvaluateMatrix, results
+  // must be identical
+  GenAlg* gaRef = UnitTestGenAlgFixtureCreate(GENALG_NBENTITIES, 
+    GENALG_NBELITES, 4);
+  GenAlg* ga = UnitTestGenAlgFixtureCreate(GENALG_NBENTITIES, 
+    GENALG_NBELITES, 4);
+  int count[1] = {0};
+  for (int iEpoch = 0; iEpoch < 10; ++iEpoch) {
+    long nbNew = 0;
+    for (int iEnt = GAGetNbAdns(ga); iEnt--;)
+      if (GAAdnIsNew(GAAdn(ga, iEnt)))
+        ++nbNew;
+    long nbEval = 0;
+    GAEvaluate(gaRef, UnitTestGenAlgEvaluateFun, count, 1);
+    GAEvaluateMatrix(ga, UnitTestGenAlgEvaluateMatrixFun, &nbEval);
+    // Check the layout of the matrix of genes
+    const GAGenesMatrix* genes = &(ga->_matrix);
+    long stride = GAGenesMatrixGetStride(genes);
+    if (nbEval != nbNew || GAGenesMatrixGetNb(genes) != nbNew ||
+      stride < nbNew || stride % 16 != 0 ||
+      (uintptr_t)GAGenesMatrixAdnF(genes, 1) % GENALG_STORE_ALIGN != 0 ||
+      (uintptr_t)GAGenesMatrixAdnI(genes, 1) % GENALG_STORE_ALIGN != 0 ||
+      (nbNew < stride && (GAGenesMatrixAdnF(genes, 3)[stride - 1] != 0.0 
+      || GAGenesMatrixAdnI(genes, 3)[stride - 1] != 0))) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GAEvaluateMatrix failed");
+      PBErrCatch(GenAlgErr);
+    }
+    for (int iEnt = GAGetNbAdns(ga); iEnt--;)
+      if (GAAdnGetId(GAAdn(ga, iEnt)) != GAAdnGetId(GAAdn(gaRef, iEnt)) ||
+        ISEQUALF(GAAdnGetVal(GAAdn(ga, iEnt)), 
+        GAAdnGetVal(GAAdn(gaRef, iEnt))) == false) {
+        GenAlgErr->_type = PBErrTypeUnitTestFailed;
+        sprintf(GenAlgErr->_msg, "GAEvaluateMatrix failed");
+        PBErrCatch(GenAlgErr);
+      }
+    GAStep(gaRef);
+    GAStep(ga);
+  }
+  GenAlgFree(&gaRef);
+  GenAlgFree(&ga);
+  printf("UnitTestGenAlgEvaluateMatrix OK\n");
+}
+
+float UnitTestGenAlgEvaluateRaceFun(const GenAlgAdn* const adn, 
+  const long iCase, const long nbCase, void* const data, 
+  const int iThread) {
+  (void)iThread;
+  // Same as evaluate() with one test case per value of x
+  const float* xs = (const float*)data;
+  float res = 0.0;
+  for (long i = iCase; i < iCase + nbCase; ++i) {
+    float y = 0.0;
+    for (int j = 4; j--;)
+      y += VecGet(GAAdnAdnF(adn), j) * 
+        fastpow(xs[i], VecGet(GAAdnAdnI(adn), j));
+    res -= fabs(ftarget(xs[i]) - y);
+  }
+  return res;
+}
+
+void UnitTestGenAlgEvaluateRace() {
+  // Run the same GenAlg with GAEvaluate and GAEvaluateRace, with one 
+  // or several threads, the elites must be identical
+  GenAlg* gaRef = UnitTestGenAlgFixtureCreate(GENALG_NBENTITIES, 
+    GENALG_NBELITES, 4);
+  GenAlg* ga = UnitTestGenAlgFixtureCreate(GENALG_NBENTITIES, 
+    GENALG_NBELITES, 4);
+  GASetFitnessCacheSize(ga, 1000);
+  GASetFitnessCacheSize(gaRef, 1000);
+  float delta = 0.02;
+  int nbCase = (int)round(4.0 / delta);
+  float* xs = PBErrMalloc(GenAlgErr, sizeof(float) * nbCase);
+  float x = -2.0;
+  for (int i = 0; i < nbCase; ++i, x += delta)
+    xs[i] = x;
+  int count[1] = {0};
+  long nbEvalCase = 0;
+  long nbEvalCaseFull = 0;
+  long nbPartial = 0;
+  for (int iEpoch = 0; iEpoch < 20; ++iEpoch) {
+    for (int iEnt = GAGetNbAdns(ga); iEnt--;)
+      if (GAAdnIsNew(GAAdn(ga, iEnt)))
+        nbEvalCaseFull += nbCase;
+    GAEvaluate(gaRef, UnitTestGenAlgEvaluateFun, count, 1);
+    nbEvalCase += GAEvaluateRace(ga, UnitTestGenAlgEvaluateRaceFun, 
+      xs, nbCase, 20, 0.0, (iEpoch % 2 == 0 ? 1 : 4));
+    for (int iEnt = GAGetNbAdns(ga); iEnt--;) {
+      GenAlgAdn* adn = GAAdn(ga, iEnt);
+      GenAlgAdn* adnRef = GAAdn(gaRef, iEnt);
+      if (GAAdnIsPartial(adn)) {
+        ++nbPartial;
+        if (GAAdnGetVal(adn) < GAAdnGetVal(adnRef) - PBMATH_EPSILON) {
+          GenAlgErr->_type = PBErrTypeUnitTestFailed;
+          sprintf(GenAlgErr->_msg, "GAEvaluateRace failed");
+          PBErrCatch(GenAlgErr);
+        }
+      } else if (GAAdnGetId(adn) != GAAdnGetId(adnRef) ||
+        ISEQUALF(GAAdnGetVal(adn), GAAdnGetVal(adnRef)) == false) {
+        GenAlgErr->_type = PBErrTypeUnitTestFailed;
+        sprintf(GenAlgErr->_msg, "GAEvaluateRace failed");
+        PBErrCatch(GenAlgErr);
+      }
+    }
+    GAStep(gaRef);
+    GAStep(ga);
+    for (int iEnt = GAGetNbElites(ga); iEnt--;)
+      if (GAAdnGetId(GAAdn(ga, iEnt)) != GAAdnGetId(GAAdn(gaRef, iEnt)) ||
+        GAAdnIsPartial(GAAdn(ga, iEnt))) {
+        GenAlgErr->_type = PBErrTypeUnitTestFailed;
+        sprintf(GenAlgErr->_msg, "GAEvaluateRace failed");
+        PBErrCatch(GenAlgErr);
+      }
+  }
+  if (nbPartial == 0 || nbEvalCase >= nbEvalCaseFull) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAEvaluateRace failed");
+    PBErrCatch(GenAlgErr);
+  }
+  free(xs);
+  GenAlgFree(&gaRef);
+  GenAlgFree(&ga);
+  printf("UnitTestGenAlgEvaluateRace OK\n");
+}
+
+void UnitTestGenAlgWorkerPool() {
+  // Run the same GenAlg with GAEvaluate and with the stub workers 
+  // (built from genalg-worker.c, which has the same fitness), results
+  // must be identical
+  GenAlg* gaRef = UnitTestGenAlgFixtureCreate(GENALG_NBENTITIES, 
+    GENALG_NBELITES, 4);
+  GenAlg* ga = UnitTestGenAlgFixtureCreate(GENALG_NBENTITIES, 
+    GENALG_NBELITES, 4);
+  GAWorkerPool* pool = GAWorkerPoolCreate("./genalg-worker", 3);
+  if (GAWorkerPoolGetNbWorker(pool) != 3 || 
+    GAWorkerPoolGetMaxBatch(pool) != 16 ||
+    GAWorkerPoolGetTimeout(pool) != -1) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAWorkerPoolCreate failed");
+    PBErrCatch(GenAlgErr);
+  }
+  GAWorkerPoolSetMaxBatch(pool, 7);
+  if (GAWorkerPoolGetMaxBatch(pool) != 7) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAWorkerPoolSetMaxBatch failed");
+    PBErrCatch(GenAlgErr);
+  }
+  GAWorkerPoolSetTimeout(pool, 10000);
+  if (GAWorkerPoolGetTimeout(pool) != 10000) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAWorkerPoolSetTimeout failed");
+    PBErrCatch(GenAlgErr);
+  }
+  int count[1] = {0};
+  for (int iEpoch = 0; iEpoch < 10; ++iEpoch) {
+    GAEvaluate(gaRef, UnitTestGenAlgEvaluateFun, count, 1);
+    if (GAWorkerPoolEvaluate(pool, ga) == false) {
+      GenAlgErr->_type = PBErrTypeUnitTestFailed;
+      sprintf(GenAlgErr->_msg, "GAWorkerPoolEvaluate failed");
+      PBErrCatch(GenAlgErr);
+    }
+    for (int iEnt = GAGetNbAdns(ga); iEnt--;)
+      if (GAAdnGetId(GAAdn(ga, iEnt)) != GAAdnGetId(GAAdn(gaRef, iEnt)) ||
+        ISEQUALF(GAAdnGetVal(GAAdn(ga, iEnt)), 
+        GAAdnGetVal(GAAdn(gaRef, iEnt))) == false) {
+        GenAlgErr->_type = PBErrTypeUnitTestFailed;
+        sprintf(GenAlgErr->_msg, "GAWorkerPoolEvaluate failed");
+        PBErrCatch(GenAlgErr);
+      }
+    GAStep(gaRef);
+    GAStep(ga);
+  }
+  GAWorkerPoolFree(&pool);
+  if (pool != NULL) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAWorkerPoolFree failed");
+    PBErrCatch(GenAlgErr);
+  }
+  // Workers which can't be run fail, and no value is set
+  pool = GAWorkerPoolCreate("./UnitTestGenAlgNoWorker", 2);
+  int nbNew = 0;
+  for (int iEnt = GAGetNbAdns(ga); iEnt--;)
+    if (GAAdnIsNew(GAAdn(ga, iEnt)))
+      ++nbNew;
+  if (nbNew == 0 || GAWorkerPoolEvaluate(pool, ga) == true || 
+    GAWorkerPoolEvaluate(pool, ga) == true) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAWorkerPoolEvaluate failed");
+    PBErrCatch(GenAlgErr);
+  }
+  for (int iEnt = GAGetNbAdns(ga); iEnt--;)
+    if (GAAdnIsNew(GAAdn(ga, iEnt)))
+      --nbNew;
+  if (nbNew != 0) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAWorkerPoolEvaluate failed");
+    PBErrCatch(GenAlgErr);
+  }
+  GAWorkerPoolFree(&pool);
+  // Workers which don't reply in time fail, and are killed
+  FILE* fp = fopen("./UnitTestGenAlgHangWorker", "w");
+  fprintf(fp, "#!/bin/sh\nexec sleep 60\n");
+  fclose(fp);
+  chmod("./UnitTestGenAlgHangWorker", 0755);
+  pool = GAWorkerPoolCreate("./UnitTestGenAlgHangWorker", 2);
+  GAWorkerPoolSetTimeout(pool, 200);
+  struct timespec start, stop;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  bool ret = GAWorkerPoolEvaluate(pool, ga);
+  GAWorkerPoolFree(&pool);
+  clock_gettime(CLOCK_MONOTONIC, &stop);
+  if (ret == true || stop.tv_sec - start.tv_sec > 10) {
+    GenAlgErr->_type = PBErrTypeUnitTestFailed;
+    sprintf(GenAlgErr->_msg, "GAWorkerPoolSetTimeout failed");
+    PBErrCatch(GenAlgErr);
+  }
+  GenAlgFree(&gaRef);
+  GenAlgFree(&ga);
+  printf("UnitTestGenAlgWorkerPool OK\n");
+}
+
+void UnitTestGenAlgWorkerPoolPerf() {
+  // Throughput of the evaluation of 100 epochs in process and with 
+  // 4 stub workers for several sizes of requests
+  int nbEpoch = 100;
+  long maxBatches[5] = {0, 1, 4, 16, 64};
+  int count[1] = {0};
+  for (int iBatch = 0; iBatch < 5; ++iBatch) {
+    GenAlg* ga = UnitTestGenAlgFixtureCreate(GENALG_NBENTITIES, 
+      GENALG_NBELITES, 4);
+    GAWorkerPool* pool = NULL;
+    if (maxBatches[iBatch] > 0) {
+      pool = GAWorkerPoolCreate("./genalg-worker", 4);
+      GAWorkerPoolSetMaxBatch(pool, maxBatches[iBatch]);
+    }
+    long nbEval = 0;
+    double duration = 0.0;
+    for (int iEpoch = 0; iEpoch < nbEpoch; ++iEpoch) {
+      for (int iEnt = GAGetNbAdns(ga); iEnt--;)
+        if (GAAdnIsNew(GAAdn(ga, iEnt)))
+          ++nbEval;
+      struct timespec start, stop;
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      if (pool != NULL)
+        GAWorkerPoolEvaluate(pool, ga);
+      else
+        GAEvaluate(ga, UnitTestGenAlgEvaluateFun, count, 1);
+      clock_gettime(CLOCK_MONOTONIC, &stop);
+      duration += (double)(stop.tv_sec - start.tv_sec) + 
+        (double)(stop.tv_nsec - start.tv_nsec) * 1e-9;
+      GAStep(ga);
+    }
+    if (pool != NULL)
+      printf("4 workers, %ld candidates per request: ", 
+        maxBatches[iBatch]);
+    else
+      printf("in process: ");
+    printf("%ld evaluations in %fs, %.0f evaluations/s\n", 
+      nbEval, duration, (double)nbEval / duration);
+    GAWorkerPoolFree(&pool);
+    GenAlgFree(&ga);
+  }
+  printf("UnitTestGenAlgWorkerPoolPerf OK\n");
+}
+
 void UnitTestGenAlg() {
   UnitTestGenAlgCreateFree();
   UnitTestGenAlgGetSet();
   UnitTestGenAlgInit();
   UnitTestGenAlgPrint();
   UnitTestGenAlgGetDiversity();
+  UnitTestGenAlgAdnGetDiversity();
+  UnitTestGenAlgEliteDiversity();
+  UnitTestGenAlgFitnessCache();
   UnitTestGenAlgStep();
+  UnitTestGenAlgMuteBounds();
+  UnitTestGenAlgMuteSparse();
   UnitTestGenAlgLoadSave();
+  UnitTestGenAlgLoadSaveBinary();
+  UnitTestGenAlgSaveStream();
+  UnitTestGenAlgCheckpoint();
+  UnitTestGenAlgAsyncIO();
   UnitTestGenAlgTest();
   UnitTestGenAlgPerf();
   UnitTestGenAlgHistory();
+  UnitTestGenAlgHistoryError();
+  UnitTestGenAlgGenealogy();
+  UnitTestGenAlgContiguousAdn();
+  UnitTestGenAlgRanks();
+  UnitTestGenAlgSelectBest();
+  UnitTestGenAlgEvaluate();
+  UnitTestGenAlgStepThread();
+  UnitTestGenAlgScratch();
+  UnitTestGenAlgIslands();
+  UnitTestGenAlgSteadyState();
+  UnitTestGenAlgAskTell();
+  UnitTestGenAlgEvaluateMatrix();
+  UnitTestGenAlgEvaluateRace();
+  UnitTestGenAlgWorkerPool();
+  UnitTestGenAlgWorkerPoolPerf();
   printf("UnitTestGenAlg OK\n");
 }
 
 void UnitTestAll() {
+  UnitTestGARng();
   UnitTestGenAlgAdn();
   UnitTestGenAlg();
   printf("UnitTestAll OK\n");